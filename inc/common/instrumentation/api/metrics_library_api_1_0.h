@@ -95,6 +95,12 @@ enum class ObjectType : uint32_t
     QueryHwCounters                 = 20000,
     QueryPipelineTimestamps         = 20001,
     QueryHwCountersCopyReports      = 20002,
+    QueryHwCountersMultisampled     = 20003,
+    QueryHwCountersCompact          = 20004,
+    QueryHwCountersColumns          = 20005,
+    QueryHwCountersStatusArray      = 20006, // Slot end tags stored in one array placed after all slot reports.
+    QueryHwCountersReadiness        = 20007, // Get data only, returns a bitmap of slots with gpu reports ready.
+    QueryHwCountersAsync            = 20008, // Get data only, returns reports resolved in background.
 
     // Configuration objects:
     ConfigurationHwCountersOa       = 30000,
@@ -128,6 +134,8 @@ enum class ClientOptionsType : uint32_t
     SubDeviceIndex,
     SubDeviceCount,
     WorkloadPartition,
+    ResolveThreads,
+    AsyncResolve,
     // ...
     Last
 };
@@ -241,6 +249,9 @@ enum class ParameterType : uint32_t
     QueryPipelineTimestampsReportApiSize,
     QueryPipelineTimestampsReportGpuSize,
     LibraryBuildNumber,
+    QueryHwCountersReportApiCountersCount,
+    QueryHwCountersReportApiCompactHeaderSize,
+    QueryHwCountersReportGpuStatusSize,
     // ...
     Last
 };
@@ -396,6 +407,21 @@ struct CommandBufferData_1_0
     };
 };
 
+//////////////////////////////////////////////////////////////////////////
+/// @brief Batched command buffer data.
+//////////////////////////////////////////////////////////////////////////
+struct CommandBufferBatchData_1_1
+{
+    ContextHandle_1_0               HandleContext;    // Context handle.
+    GpuCommandBufferType            Type;             // Gpu command buffer type.
+    void*                           Data;             // Gpu command buffer data.
+    uint32_t                        Size;             // Gpu command buffer size.
+    const CommandBufferData_1_0*    Commands;         // Commands written back to back, their context, type, data, size and offset are ignored.
+    uint32_t                        CommandsCount;    // Commands count.
+    uint32_t*                       Offsets;          // Optional, each command offset from the gpu command buffer beginning.
+    uint32_t*                       Sizes;            // Optional, each command size.
+};
+
 //////////////////////////////////////////////////////////////////////////
 /// @brief Command buffer size.
 //////////////////////////////////////////////////////////////////////////
@@ -454,6 +480,93 @@ struct GetReportQuery_1_0
     void*              Data;          // Input / output.
 };
 
+//////////////////////////////////////////////////////////////////////////
+/// @brief Get all multisampled query reports of a single slot.
+//////////////////////////////////////////////////////////////////////////
+struct GetReportQueryMultisampled_1_0
+{
+    QueryHandle_1_0    Handle;          // Input.
+
+    uint32_t           Slot;            // Input.
+
+    uint32_t           DataSize;        // Input.
+    void*              Data;            // Output.
+
+    uint32_t           ReportsCount;    // Output.
+    bool               Completed;       // Output.
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Get query reports in compact format. Each report contains
+///        a header followed by values of counters selected in the mask.
+//////////////////////////////////////////////////////////////////////////
+struct GetReportQueryCompact_1_0
+{
+    QueryHandle_1_0    Handle;                // Input.
+
+    uint32_t           Slot;                  // Input.
+    uint32_t           SlotsCount;            // Input.
+
+    const uint64_t*    CountersMask;          // Input.
+    uint32_t           CountersMaskCount;     // Input.
+
+    uint32_t           DataSize;              // Input.
+    void*              Data;                  // Output.
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Get query reports in structure of arrays format. Each counter
+///        value is written to its column at the slot position.
+//////////////////////////////////////////////////////////////////////////
+struct GetReportQueryColumns_1_0
+{
+    QueryHandle_1_0    Handle;           // Input.
+
+    uint32_t           Slot;             // Input.
+    uint32_t           SlotsCount;       // Input.
+
+    uint64_t**         Columns;          // Input, columns are indexed the same way as compact report counters.
+    uint32_t           ColumnsCount;     // Input.
+
+    uint64_t*          TotalTime;        // Output, optional.
+    uint64_t*          GpuTicks;         // Output, optional.
+    uint32_t*          Flags;            // Output, optional.
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Get a bitmap of query slots whose gpu reports are ready. Bit i
+///        of the bitmap refers to slot Slot + i.
+//////////////////////////////////////////////////////////////////////////
+struct GetReportQueryReadiness_1_0
+{
+    QueryHandle_1_0    Handle;         // Input.
+
+    uint32_t           Slot;           // Input.
+    uint32_t           SlotsCount;     // Input.
+
+    uint64_t*          Bitmap;         // Output.
+    uint32_t           BitmapCount;    // Input, count of 64 bit bitmap words.
+
+    uint32_t           ReadyCount;     // Output.
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Get query reports resolved in background for all queries
+///        of a given context. Reports are returned in resolve order.
+//////////////////////////////////////////////////////////////////////////
+struct GetReportQueryAsync_1_0
+{
+    ContextHandle_1_0    Handle;          // Input.
+
+    uint32_t             DataSize;        // Input.
+    void*                Data;            // Output.
+
+    QueryHandle_1_0*     Queries;         // Output, optional, query of each returned report.
+    uint32_t*            Slots;           // Output, optional, slot of each returned report.
+
+    uint32_t             ReportsCount;    // Output.
+};
+
 //////////////////////////////////////////////////////////////////////////
 /// @brief Get override report.
 //////////////////////////////////////////////////////////////////////////
@@ -474,8 +587,13 @@ struct GetReportData_1_0
 
     union
     {
-        GetReportQuery_1_0       Query;
-        GetReportOverride_1_0    Override;
+        GetReportQuery_1_0                Query;
+        GetReportQueryMultisampled_1_0    QueryMultisampled;
+        GetReportQueryCompact_1_0         QueryCompact;
+        GetReportQueryColumns_1_0         QueryColumns;
+        GetReportQueryReadiness_1_0       QueryReadiness;
+        GetReportQueryAsync_1_0           QueryAsync;
+        GetReportOverride_1_0             Override;
     };
 };
 
@@ -564,6 +682,22 @@ struct Interface_1_0
     GetDataFunction_1_0                    GetData;
 };
 
+//////////////////////////////////////////////////////////////////////////
+/// @brief Metrics Library 1.1 functions.
+//////////////////////////////////////////////////////////////////////////
+using CommandBufferGetBatchFunction_1_1     = StatusCode( ML_STDCALL* ) ( const CommandBufferBatchData_1_1* data );
+using CommandBufferGetBatchSizeFunction_1_1 = StatusCode( ML_STDCALL* ) ( const CommandBufferBatchData_1_1* data, CommandBufferSize_1_0* size );
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Metrics Library interface functions added in 1.1.
+///        Returned for a created context by ContextGetInterface_1_1.
+//////////////////////////////////////////////////////////////////////////
+struct Interface_1_1
+{
+    CommandBufferGetBatchFunction_1_1        CommandBufferGetBatch;
+    CommandBufferGetBatchSizeFunction_1_1    CommandBufferGetBatchSize;
+};
+
 //////////////////////////////////////////////////////////////////////////
 /// @brief Metrics Library interface callbacks.
 //////////////////////////////////////////////////////////////////////////
@@ -681,6 +815,23 @@ struct ClientOptionsWorkloadPartition_1_0
     bool    Enabled;
 };
 
+//////////////////////////////////////////////////////////////////////////
+/// @brief Client options resolve threads data.
+//////////////////////////////////////////////////////////////////////////
+struct ClientOptionsResolveThreadsData_1_0
+{
+    uint32_t    Count;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Client options async resolve data.
+//////////////////////////////////////////////////////////////////////////
+struct ClientOptionsAsyncResolveData_1_0
+{
+    bool        Enabled;
+    uint32_t    ReportsCount;    // Capacity of resolved reports stored by the library.
+};
+
 //////////////////////////////////////////////////////////////////////////
 /// @brief Client options data.
 //////////////////////////////////////////////////////////////////////////
@@ -698,6 +849,8 @@ struct ClientOptionsData_1_0
         ClientOptionsSubDeviceIndexData_1_0    SubDeviceIndex;
         ClientOptionsSubDeviceCountData_1_0    SubDeviceCount;
         ClientOptionsWorkloadPartition_1_0     WorkloadPartition;
+        ClientOptionsResolveThreadsData_1_0    ResolveThreads;
+        ClientOptionsAsyncResolveData_1_0      AsyncResolve;
     };
 };
 
@@ -731,17 +884,21 @@ struct ContextCreateData_1_0
 using ContextCreateFunction_1_0 = StatusCode ( ML_STDCALL* ) ( ClientType_1_0 clientType, ContextCreateData_1_0* createData, ContextHandle_1_0* handle );
 using ContextDeleteFunction_1_0 = StatusCode ( ML_STDCALL* ) ( const ContextHandle_1_0 handle );
 
+using ContextGetInterfaceFunction_1_1 = StatusCode ( ML_STDCALL* ) ( const ContextHandle_1_0 handle, Interface_1_1* api );
+
 //////////////////////////////////////////////////////////////////////////
 /// @brief Metrics Library initialize/destroy functions.
 //////////////////////////////////////////////////////////////////////////
 #define METRICS_LIBRARY_CONTEXT_CREATE_1_0 "ContextCreate_1_0"
 #define METRICS_LIBRARY_CONTEXT_DELETE_1_0 "ContextDelete_1_0"
 
+#define METRICS_LIBRARY_CONTEXT_GET_INTERFACE_1_1 "ContextGetInterface_1_1"
+
 //////////////////////////////////////////////////////////////////////////
 /// @brief Metrics Library current version.
 //////////////////////////////////////////////////////////////////////////
 #define METRICS_LIBRARY_MAJOR_NUMBER 1
-#define METRICS_LIBRARY_MINOR_NUMBER 0
+#define METRICS_LIBRARY_MINOR_NUMBER 1
 #define METRICS_LIBRARY_BUILD_NUMBER 234
 
 } // namespace MetricsLibraryApi
@@ -48,9 +48,10 @@ namespace ML
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief Virtual GetInterface function.
+        /// @brief Virtual GetInterface functions.
         //////////////////////////////////////////////////////////////////////////
         virtual void GetInterface( Interface_1_0& interface ) const = 0;
+        virtual void GetInterface( Interface_1_1& interface ) const = 0;
     };
 
     const DdiFunctionTableBase* GetDdiFunctionTable( const ClientType_1_0& clientType );
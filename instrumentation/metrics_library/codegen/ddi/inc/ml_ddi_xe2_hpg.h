@@ -35,6 +35,8 @@ namespace ML::XE2_HPG::OpenCL
     StatusCode ML_STDCALL GetParameter_1_0( const ParameterType, ValueType*, TypedValue_1_0* );
     StatusCode ML_STDCALL CommandBufferGet_1_0( const CommandBufferData_1_0* );
     StatusCode ML_STDCALL CommandBufferGetSize_1_0( const CommandBufferData_1_0*, CommandBufferSize_1_0* );
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1( const CommandBufferBatchData_1_1* );
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1( const CommandBufferBatchData_1_1*, CommandBufferSize_1_0* );
     StatusCode ML_STDCALL QueryCreate_1_0( const QueryCreateData_1_0*, QueryHandle_1_0* );
     StatusCode ML_STDCALL QueryDelete_1_0( const QueryHandle_1_0 );
     StatusCode ML_STDCALL OverrideCreate_1_0( const OverrideCreateData_1_0*, OverrideHandle_1_0* );
@@ -81,6 +83,13 @@ namespace ML::XE2_HPG::OpenCL
             interface.MarkerDelete                        = MarkerDelete_1_0;
         }
 
+        void GetInterface( Interface_1_1& interface ) const
+        {
+            interface = {};
+            interface.CommandBufferGetBatch               = CommandBufferGetBatch_1_1;
+            interface.CommandBufferGetBatchSize           = CommandBufferGetBatchSize_1_1;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Returns an instance of DdiFunctionTable object.
         /// @return singleton DdiFunctionTable object.
@@ -106,6 +115,8 @@ namespace ML::XE2_HPG::OneApi
     StatusCode ML_STDCALL GetParameter_1_0( const ParameterType, ValueType*, TypedValue_1_0* );
     StatusCode ML_STDCALL CommandBufferGet_1_0( const CommandBufferData_1_0* );
     StatusCode ML_STDCALL CommandBufferGetSize_1_0( const CommandBufferData_1_0*, CommandBufferSize_1_0* );
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1( const CommandBufferBatchData_1_1* );
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1( const CommandBufferBatchData_1_1*, CommandBufferSize_1_0* );
     StatusCode ML_STDCALL QueryCreate_1_0( const QueryCreateData_1_0*, QueryHandle_1_0* );
     StatusCode ML_STDCALL QueryDelete_1_0( const QueryHandle_1_0 );
     StatusCode ML_STDCALL OverrideCreate_1_0( const OverrideCreateData_1_0*, OverrideHandle_1_0* );
@@ -152,6 +163,13 @@ namespace ML::XE2_HPG::OneApi
             interface.MarkerDelete                        = MarkerDelete_1_0;
         }
 
+        void GetInterface( Interface_1_1& interface ) const
+        {
+            interface = {};
+            interface.CommandBufferGetBatch               = CommandBufferGetBatch_1_1;
+            interface.CommandBufferGetBatchSize           = CommandBufferGetBatchSize_1_1;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Returns an instance of DdiFunctionTable object.
         /// @return singleton DdiFunctionTable object.
@@ -57,6 +57,25 @@ namespace ML::XE_LP::OpenCL
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE_LP::OpenCL
 #endif // ML_ENABLE_OPENCL
 
@@ -82,6 +101,25 @@ namespace ML::XE_LP::OneApi
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE_LP::OneApi
 #endif // ML_ENABLE_ONEAPI
 
@@ -116,6 +154,25 @@ namespace ML::XE_HPG::OpenCL
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE_HPG::OpenCL
 #endif // ML_ENABLE_OPENCL
 
@@ -141,6 +198,25 @@ namespace ML::XE_HPG::OneApi
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE_HPG::OneApi
 #endif // ML_ENABLE_ONEAPI
 
@@ -175,6 +251,25 @@ namespace ML::XE_HPC::OpenCL
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE_HPC::OpenCL
 #endif // ML_ENABLE_OPENCL
 
@@ -200,6 +295,25 @@ namespace ML::XE_HPC::OneApi
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE_HPC::OneApi
 #endif // ML_ENABLE_ONEAPI
 
@@ -234,6 +348,25 @@ namespace ML::XE2_HPG::OpenCL
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE2_HPG::OpenCL
 #endif // ML_ENABLE_OPENCL
 
@@ -259,6 +392,25 @@ namespace ML::XE2_HPG::OneApi
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE2_HPG::OneApi
 #endif // ML_ENABLE_ONEAPI
 
@@ -293,6 +445,25 @@ namespace ML::XE3::OpenCL
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE3::OpenCL
 #endif // ML_ENABLE_OPENCL
 
@@ -318,6 +489,25 @@ namespace ML::XE3::OneApi
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE3::OneApi
 #endif // ML_ENABLE_ONEAPI
 
@@ -352,6 +542,25 @@ namespace ML::XE3P::OpenCL
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE3P::OpenCL
 #endif // ML_ENABLE_OPENCL
 
@@ -377,6 +586,25 @@ namespace ML::XE3P::OneApi
         return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatch_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+        const CommandBufferBatchData_1_1* data )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates template function for CommandBufferGetBatchSize_1_1.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+        const CommandBufferBatchData_1_1* data,
+        CommandBufferSize_1_0*            size )
+    {
+        return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size );
+    }
+
 } // namespace ML::XE3P::OneApi
 #endif // ML_ENABLE_ONEAPI
 
@@ -313,6 +313,36 @@ extern "C"
         }
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief  Export of metrics_library api entry ContextGetInterface_1_1.
+    /// @param  handle
+    /// @param  api
+    /// @return StatusCode
+    //////////////////////////////////////////////////////////////////////////
+    ML_EXPORT( StatusCode ) ContextGetInterface_1_1( const ContextHandle_1_0 handle, Interface_1_1* api )
+    {
+        auto overriddenContextGetInterface_1_1 = reinterpret_cast<ContextGetInterfaceFunction_1_1>( DriverStoreOs::GetRedirectedDdi( METRICS_LIBRARY_CONTEXT_GET_INTERFACE_1_1 ) );
+
+        if( overriddenContextGetInterface_1_1 != nullptr )
+        {
+            return overriddenContextGetInterface_1_1( handle, api );
+        }
+        else
+        {
+            // Obtain function table.
+            auto functionTable = GetDdiFunctionTable( handle );
+            ML_ASSERT_NO_ADAPTER( functionTable != nullptr );
+
+            if( functionTable == nullptr || api == nullptr )
+            {
+                return StatusCode::NullPointer;
+            }
+
+            functionTable->GetInterface( *api );
+            return StatusCode::Success;
+        }
+    }
+
 #if defined( __cplusplus )
 }
 #endif // C++
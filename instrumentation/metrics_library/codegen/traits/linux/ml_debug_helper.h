@@ -59,16 +59,6 @@ namespace ML
             return mutex;
         }
 
-        //////////////////////////////////////////////////////////////////////////
-        /// @brief  Returns functions names map.
-        /// @return map of functions names.
-        //////////////////////////////////////////////////////////////////////////
-        ML_INLINE static std::unordered_map<std::string, std::string>& GetFunctionNamesMap()
-        {
-            static std::unordered_map<std::string, std::string> functionNamesMap;
-            return functionNamesMap;
-        }
-
         //////////////////////////////////////////////////////////////////////////
         /// @brief Increments an indent level.
         //////////////////////////////////////////////////////////////////////////
@@ -372,6 +362,10 @@ namespace ML
 
             switch( value )
             {
+                case ClientOptionsType::AsyncResolve:
+                    output << "AsyncResolve";
+                    break;
+
                 case ClientOptionsType::Compute:
                     output << "Compute";
                     break;
@@ -388,6 +382,10 @@ namespace ML
                     output << "Ptbr";
                     break;
 
+                case ClientOptionsType::ResolveThreads:
+                    output << "ResolveThreads";
+                    break;
+
                 case ClientOptionsType::SubDevice:
                     output << "SubDevice";
                     break;
@@ -664,10 +662,34 @@ namespace ML
                     output << "QueryHwCounters";
                     break;
 
+                case ObjectType::QueryHwCountersAsync:
+                    output << "QueryHwCountersAsync";
+                    break;
+
+                case ObjectType::QueryHwCountersColumns:
+                    output << "QueryHwCountersColumns";
+                    break;
+
+                case ObjectType::QueryHwCountersCompact:
+                    output << "QueryHwCountersCompact";
+                    break;
+
                 case ObjectType::QueryHwCountersCopyReports:
                     output << "QueryHwCountersCopyReports";
                     break;
 
+                case ObjectType::QueryHwCountersMultisampled:
+                    output << "QueryHwCountersMultisampled";
+                    break;
+
+                case ObjectType::QueryHwCountersReadiness:
+                    output << "QueryHwCountersReadiness";
+                    break;
+
+                case ObjectType::QueryHwCountersStatusArray:
+                    output << "QueryHwCountersStatusArray";
+                    break;
+
                 case ObjectType::QueryPipelineTimestamps:
                     output << "QueryPipelineTimestamps";
                     break;
@@ -708,6 +730,14 @@ namespace ML
                     output << "LibraryBuildNumber";
                     break;
 
+                case ParameterType::QueryHwCountersReportApiCompactHeaderSize:
+                    output << "QueryHwCountersReportApiCompactHeaderSize";
+                    break;
+
+                case ParameterType::QueryHwCountersReportApiCountersCount:
+                    output << "QueryHwCountersReportApiCountersCount";
+                    break;
+
                 case ParameterType::QueryHwCountersReportApiSize:
                     output << "QueryHwCountersReportApiSize";
                     break;
@@ -716,6 +746,10 @@ namespace ML
                     output << "QueryHwCountersReportGpuSize";
                     break;
 
+                case ParameterType::QueryHwCountersReportGpuStatusSize:
+                    output << "QueryHwCountersReportGpuStatusSize";
+                    break;
+
                 case ParameterType::QueryPipelineTimestampsReportApiSize:
                     output << "QueryPipelineTimestampsReportApiSize";
                     break;
@@ -1422,6 +1456,22 @@ namespace ML
             return output.str();
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Converts all structure members values to a string.
+        /// @param  value   a given structure to convert.
+        /// @return         converted all members values to string.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::string ToString( const ClientOptionsAsyncResolveData_1_0& value )
+        {
+            std::ostringstream output;
+            output << "ClientOptionsAsyncResolveData_1_0:" << '\n';
+            IncrementIndentLevel();
+            output << MemberToString( "Enabled          ", value.Enabled );
+            output << MemberToString( "ReportsCount     ", value.ReportsCount );
+            DecrementIndentLevel();
+            return output.str();
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Converts all structure members values to a string.
         /// @param  value   a given structure to convert.
@@ -1483,6 +1533,14 @@ namespace ML
                     output << MemberToString( "WorkloadPartition            ", value.WorkloadPartition );
                     break;
 
+                case ClientOptionsType::ResolveThreads:
+                    output << MemberToString( "ResolveThreads               ", value.ResolveThreads );
+                    break;
+
+                case ClientOptionsType::AsyncResolve:
+                    output << MemberToString( "AsyncResolve                 ", value.AsyncResolve );
+                    break;
+
                 default:
                     output << "Not known member.\n";
                     break;
@@ -1522,6 +1580,21 @@ namespace ML
             return output.str();
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Converts all structure members values to a string.
+        /// @param  value   a given structure to convert.
+        /// @return         converted all members values to string.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::string ToString( const ClientOptionsResolveThreadsData_1_0& value )
+        {
+            std::ostringstream output;
+            output << "ClientOptionsResolveThreadsData_1_0:" << '\n';
+            IncrementIndentLevel();
+            output << MemberToString( "Count            ", value.Count );
+            DecrementIndentLevel();
+            return output.str();
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Converts all structure members values to a string.
         /// @param  value   a given structure to convert.
@@ -1786,6 +1859,28 @@ namespace ML
             return output.str();
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Converts all structure members values to a string.
+        /// @param  value   a given structure to convert.
+        /// @return         converted all members values to string.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::string ToString( const CommandBufferBatchData_1_1& value )
+        {
+            std::ostringstream output;
+            output << "CommandBufferBatchData_1_1:" << '\n';
+            IncrementIndentLevel();
+            output << MemberToString( "HandleContext                    ", value.HandleContext );
+            output << MemberToString( "Type                             ", value.Type );
+            output << MemberToString( "Data                             ", reinterpret_cast<uintptr_t>( value.Data ) );
+            output << MemberToString( "Size                             ", value.Size );
+            output << MemberToString( "Commands                         ", reinterpret_cast<uintptr_t>( value.Commands ) );
+            output << MemberToString( "CommandsCount                    ", value.CommandsCount );
+            output << MemberToString( "Offsets                          ", reinterpret_cast<uintptr_t>( value.Offsets ) );
+            output << MemberToString( "Sizes                            ", reinterpret_cast<uintptr_t>( value.Sizes ) );
+            DecrementIndentLevel();
+            return output.str();
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Converts all structure members values to a string.
         /// @param  value   a given structure to convert.
@@ -1918,6 +2013,26 @@ namespace ML
                     output << MemberToString( "Query              ", value.Query );
                     break;
 
+                case ObjectType::QueryHwCountersMultisampled:
+                    output << MemberToString( "QueryMultisampled  ", value.QueryMultisampled );
+                    break;
+
+                case ObjectType::QueryHwCountersCompact:
+                    output << MemberToString( "QueryCompact       ", value.QueryCompact );
+                    break;
+
+                case ObjectType::QueryHwCountersColumns:
+                    output << MemberToString( "QueryColumns       ", value.QueryColumns );
+                    break;
+
+                case ObjectType::QueryHwCountersReadiness:
+                    output << MemberToString( "QueryReadiness     ", value.QueryReadiness );
+                    break;
+
+                case ObjectType::QueryHwCountersAsync:
+                    output << MemberToString( "QueryAsync         ", value.QueryAsync );
+                    break;
+
                 case ObjectType::QueryPipelineTimestamps:
                     output << MemberToString( "Query              ", value.Query );
                     break;
@@ -1987,6 +2102,109 @@ namespace ML
             return output.str();
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Converts all structure members values to a string.
+        /// @param  value   a given structure to convert.
+        /// @return         converted all members values to string.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::string ToString( const GetReportQueryAsync_1_0& value )
+        {
+            std::ostringstream output;
+            output << "GetReportQueryAsync_1_0:" << '\n';
+            IncrementIndentLevel();
+            output << MemberToString( "Handle                 ", value.Handle );
+            output << MemberToString( "DataSize               ", value.DataSize );
+            output << MemberToString( "Data                   ", reinterpret_cast<uintptr_t>( value.Data ) );
+            output << MemberToString( "Queries                ", reinterpret_cast<uintptr_t>( value.Queries ) );
+            output << MemberToString( "Slots                  ", reinterpret_cast<uintptr_t>( value.Slots ) );
+            output << MemberToString( "ReportsCount           ", value.ReportsCount );
+            DecrementIndentLevel();
+            return output.str();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Converts all structure members values to a string.
+        /// @param  value   a given structure to convert.
+        /// @return         converted all members values to string.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::string ToString( const GetReportQueryColumns_1_0& value )
+        {
+            std::ostringstream output;
+            output << "GetReportQueryColumns_1_0:" << '\n';
+            IncrementIndentLevel();
+            output << MemberToString( "Handle                 ", value.Handle );
+            output << MemberToString( "Slot                   ", value.Slot );
+            output << MemberToString( "SlotsCount             ", value.SlotsCount );
+            output << MemberToString( "Columns                ", reinterpret_cast<uintptr_t>( value.Columns ) );
+            output << MemberToString( "ColumnsCount           ", value.ColumnsCount );
+            output << MemberToString( "TotalTime              ", reinterpret_cast<uintptr_t>( value.TotalTime ) );
+            output << MemberToString( "GpuTicks               ", reinterpret_cast<uintptr_t>( value.GpuTicks ) );
+            output << MemberToString( "Flags                  ", reinterpret_cast<uintptr_t>( value.Flags ) );
+            DecrementIndentLevel();
+            return output.str();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Converts all structure members values to a string.
+        /// @param  value   a given structure to convert.
+        /// @return         converted all members values to string.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::string ToString( const GetReportQueryCompact_1_0& value )
+        {
+            std::ostringstream output;
+            output << "GetReportQueryCompact_1_0:" << '\n';
+            IncrementIndentLevel();
+            output << MemberToString( "Handle                 ", value.Handle );
+            output << MemberToString( "Slot                   ", value.Slot );
+            output << MemberToString( "SlotsCount             ", value.SlotsCount );
+            output << MemberToString( "CountersMask           ", reinterpret_cast<uintptr_t>( value.CountersMask ) );
+            output << MemberToString( "CountersMaskCount      ", value.CountersMaskCount );
+            output << MemberToString( "DataSize               ", value.DataSize );
+            output << MemberToString( "Data                   ", reinterpret_cast<uintptr_t>( value.Data ) );
+            DecrementIndentLevel();
+            return output.str();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Converts all structure members values to a string.
+        /// @param  value   a given structure to convert.
+        /// @return         converted all members values to string.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::string ToString( const GetReportQueryMultisampled_1_0& value )
+        {
+            std::ostringstream output;
+            output << "GetReportQueryMultisampled_1_0:" << '\n';
+            IncrementIndentLevel();
+            output << MemberToString( "Handle                 ", value.Handle );
+            output << MemberToString( "Slot                   ", value.Slot );
+            output << MemberToString( "DataSize               ", value.DataSize );
+            output << MemberToString( "Data                   ", reinterpret_cast<uintptr_t>( value.Data ) );
+            output << MemberToString( "ReportsCount           ", value.ReportsCount );
+            output << MemberToString( "Completed              ", value.Completed );
+            DecrementIndentLevel();
+            return output.str();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Converts all structure members values to a string.
+        /// @param  value   a given structure to convert.
+        /// @return         converted all members values to string.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::string ToString( const GetReportQueryReadiness_1_0& value )
+        {
+            std::ostringstream output;
+            output << "GetReportQueryReadiness_1_0:" << '\n';
+            IncrementIndentLevel();
+            output << MemberToString( "Handle                 ", value.Handle );
+            output << MemberToString( "Slot                   ", value.Slot );
+            output << MemberToString( "SlotsCount             ", value.SlotsCount );
+            output << MemberToString( "Bitmap                 ", reinterpret_cast<uintptr_t>( value.Bitmap ) );
+            output << MemberToString( "BitmapCount            ", value.BitmapCount );
+            output << MemberToString( "ReadyCount             ", value.ReadyCount );
+            DecrementIndentLevel();
+            return output.str();
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Converts all structure members values to a string.
         /// @param  value   a given structure to convert.
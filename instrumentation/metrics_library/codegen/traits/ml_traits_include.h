@@ -33,6 +33,8 @@ Template:           Tools/MetricsLibraryGenerator/templates/traits_include.h
 /// @brief Tools:
 //////////////////////////////////////////////////////////////////////////
 #include "ml_tools.h"
+#include "ml_trace.h"
+#include "ml_thread_pool.h"
 #if ML_LINUX
     #include "linux/ml_tools_os.h"
 #endif
@@ -154,6 +156,7 @@ Template:           Tools/MetricsLibraryGenerator/templates/traits_include.h
 #include "ml_query_hw_counters_slot.h"
 #include "ml_query_hw_counters.h"
 #include "ml_query_hw_counters_calculator.h"
+#include "ml_query_hw_counters_resolver.h"
 
 //////////////////////////////////////////////////////////////////////////
 /// @brief Internal features:
@@ -58,6 +58,8 @@ namespace ML::XE3P::OpenCL
         /// @brief Tools.
         //////////////////////////////////////////////////////////////////////////
         using Tools                         = ToolsTrait<Traits>;                           //  ml_tools.h
+        using Trace                         = ML::Trace;                                    //  ml_trace.h
+        using ThreadPool                    = ThreadPoolTrait<Traits>;                      //  ml_thread_pool.h
         #if ML_LINUX
         using ToolsOs                       = ToolsOsTrait<Traits>;                         //  linux/ml_tools_os.h
         #endif
@@ -94,6 +96,7 @@ namespace ML::XE3P::OpenCL
         //////////////////////////////////////////////////////////////////////////
         using GpuCommandBuffer              = GpuCommandBufferTrait<Traits>;                //  ml_gpu_command_buffer.h
         using GpuCommandBufferCalculator    = GpuCommandBufferCalculatorTrait<Traits>;      //  ml_gpu_command_buffer.h
+        using GpuCommandBufferTemplate      = GpuCommandBufferTemplateTrait<Traits>;        //  ml_gpu_command_buffer.h
         using GpuCommands                   = GpuCommandsTrait<Traits>;                     //  ml_gpu_commands.h
         using GpuRegisters                  = GpuRegistersTrait<Traits>;                    //  ml_gpu_registers.h
 
@@ -197,6 +200,7 @@ namespace ML::XE3P::OpenCL
             using HwCountersSlot              = QueryHwCountersSlotTrait<Traits>;               //  ml_query_hw_counters_slot.h
             using HwCounters                  = QueryHwCountersTrait<Traits>;                   //  ml_query_hw_counters.h
             using HwCountersCalculator        = QueryHwCountersCalculatorTrait<Traits>;         //  ml_query_hw_counters_calculator.h
+            using HwCountersResolver          = QueryHwCountersResolverTrait<Traits>;           //  ml_query_hw_counters_resolver.h
         };
 
         //////////////////////////////////////////////////////////////////////////
@@ -239,6 +243,8 @@ namespace ML::XE3P::OneApi
         /// @brief Tools.
         //////////////////////////////////////////////////////////////////////////
         using Tools                         = ToolsTrait<Traits>;                           //  ml_tools.h
+        using Trace                         = ML::Trace;                                    //  ml_trace.h
+        using ThreadPool                    = ThreadPoolTrait<Traits>;                      //  ml_thread_pool.h
         #if ML_LINUX
         using ToolsOs                       = ToolsOsTrait<Traits>;                         //  linux/ml_tools_os.h
         #endif
@@ -275,6 +281,7 @@ namespace ML::XE3P::OneApi
         //////////////////////////////////////////////////////////////////////////
         using GpuCommandBuffer              = GpuCommandBufferTrait<Traits>;                //  ml_gpu_command_buffer.h
         using GpuCommandBufferCalculator    = GpuCommandBufferCalculatorTrait<Traits>;      //  ml_gpu_command_buffer.h
+        using GpuCommandBufferTemplate      = GpuCommandBufferTemplateTrait<Traits>;        //  ml_gpu_command_buffer.h
         using GpuCommands                   = GpuCommandsTrait<Traits>;                     //  ml_gpu_commands.h
         using GpuRegisters                  = GpuRegistersTrait<Traits>;                    //  ml_gpu_registers.h
 
@@ -378,6 +385,7 @@ namespace ML::XE3P::OneApi
             using HwCountersSlot              = QueryHwCountersSlotTrait<Traits>;               //  ml_query_hw_counters_slot.h
             using HwCounters                  = QueryHwCountersTrait<Traits>;                   //  ml_query_hw_counters.h
             using HwCountersCalculator        = QueryHwCountersCalculatorTrait<Traits>;         //  ml_query_hw_counters_calculator.h
+            using HwCountersResolver          = QueryHwCountersResolverTrait<Traits>;           //  ml_query_hw_counters_resolver.h
         };
 
         //////////////////////////////////////////////////////////////////////////
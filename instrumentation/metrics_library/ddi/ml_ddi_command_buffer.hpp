@@ -45,40 +45,88 @@ namespace ML
 
             TT::GpuCommandBuffer buffer = { data->Data, data->Size, data->Type, data->Allocation, context };
 
-            switch( data->CommandsType )
+            log.m_Result = Write( buffer, *data );
+
+            ML_ASSERT( log.m_Result == StatusCode::Success );
+
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Generic implementation for CommandBufferGetSize_1_0
+        /// @param data
+        /// @param size
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static StatusCode ML_STDCALL CommandBufferGetSize_1_0(
+            const CommandBufferData_1_0* data,
+            CommandBufferSize_1_0*       size )
+        {
+            ML_FUNCTION_CHECK_STATIC( data != nullptr );
+            ML_FUNCTION_CHECK_STATIC( size != nullptr );
+            ML_FUNCTION_CHECK_STATIC( T::Context::IsValid( data->HandleContext ) );
+
+            auto& context = T::Context::FromHandle( data->HandleContext );
+            ML_FUNCTION_LOG( StatusCode::Success, &context );
+
+            // Print input values.
+            log.Input( *data );
+
+            TT::GpuCommandBufferCalculator buffer = { data->Type, context };
+
+            log.m_Result = Write( buffer, *data );
+
+            if( ML_SUCCESS( log.m_Result ) )
             {
-                case ObjectType::QueryHwCounters:
-                    log.m_Result = T::Queries::HwCounters::Write( buffer, data->Allocation, data->QueryHwCounters );
-                    break;
+                buffer.GetSizeRequirements( *size );
 
-                case ObjectType::QueryHwCountersCopyReports:
-                    log.m_Result = T::Queries::HwCounters::CopyReports( buffer, data->QueryHwCountersCopyReports );
-                    break;
+                // Print output values.
+                log.Output( *size );
+            }
+            else
+            {
+                ML_ASSERT_ALWAYS();
+            }
 
-                case ObjectType::OverrideUser:
-                    log.m_Result = T::Overrides::User::Write( buffer, data->Override );
-                    break;
+            return log.m_Result;
+        }
 
-                case ObjectType::OverrideFlushCaches:
-                    log.m_Result = T::Overrides::FlushCaches::Write( buffer );
-                    break;
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Generic implementation for CommandBufferGetBatch_1_1
+        /// @param data
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static StatusCode ML_STDCALL CommandBufferGetBatch_1_1(
+            const CommandBufferBatchData_1_1* data )
+        {
+            ML_FUNCTION_CHECK_STATIC( data != nullptr );
+            ML_FUNCTION_CHECK_STATIC( data->Commands != nullptr || data->CommandsCount == 0 );
+            ML_FUNCTION_CHECK_STATIC( T::Context::IsValid( data->HandleContext ) );
 
-                case ObjectType::OverrideNullHardware:
-                    log.m_Result = T::Overrides::NullHardware::Write( buffer, data->Override.Enable );
-                    break;
+            auto& context = T::Context::FromHandle( data->HandleContext );
+            ML_FUNCTION_LOG( StatusCode::Success, &context );
 
-                case ObjectType::MarkerStreamUser:
-                    log.m_Result = T::Markers::StreamUser::Write( buffer, data->MarkerStreamUser );
-                    break;
+            // Print input values.
+            log.Input( *data );
 
-                case ObjectType::MarkerStreamUserExtended:
-                    log.m_Result = T::Markers::StreamUserExtended::Write( buffer, data->MarkerStreamUserExtended );
-                    break;
+            uint32_t offset = 0;
 
-                default:
-                    ML_ASSERT_ALWAYS();
-                    log.m_Result = StatusCode::IncorrectObject;
+            for( uint32_t i = 0; i < data->CommandsCount && ML_SUCCESS( log.m_Result ); ++i )
+            {
+                const auto& command = data->Commands[i];
+
+                // Each command uses its own command buffer view, so commands that depend on
+                // the command buffer pointer (e.g. query id) behave as for separate calls.
+                if( offset >= data->Size )
+                {
+                    log.m_Result = StatusCode::InsufficientSpace;
                     break;
+                }
+
+                TT::GpuCommandBuffer buffer = { static_cast<uint8_t*>( data->Data ) + offset, data->Size - offset, data->Type, command.Allocation, context };
+
+                log.m_Result = Write( buffer, command );
+
+                StoreBatchCommand( *data, i, offset, buffer.m_Usage );
+                offset += buffer.m_Usage;
             }
 
             ML_ASSERT( log.m_Result == StatusCode::Success );
@@ -87,16 +135,17 @@ namespace ML
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief Generic implementation for CommandBufferGetSize_1_0
+        /// @brief Generic implementation for CommandBufferGetBatchSize_1_1
         /// @param data
         /// @param size
         //////////////////////////////////////////////////////////////////////////
-        ML_INLINE static StatusCode ML_STDCALL CommandBufferGetSize_1_0(
-            const CommandBufferData_1_0* data,
-            CommandBufferSize_1_0*       size )
+        ML_INLINE static StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1(
+            const CommandBufferBatchData_1_1* data,
+            CommandBufferSize_1_0*            size )
         {
             ML_FUNCTION_CHECK_STATIC( data != nullptr );
             ML_FUNCTION_CHECK_STATIC( size != nullptr );
+            ML_FUNCTION_CHECK_STATIC( data->Commands != nullptr || data->CommandsCount == 0 );
             ML_FUNCTION_CHECK_STATIC( T::Context::IsValid( data->HandleContext ) );
 
             auto& context = T::Context::FromHandle( data->HandleContext );
@@ -107,55 +156,93 @@ namespace ML
 
             TT::GpuCommandBufferCalculator buffer = { data->Type, context };
 
-            switch( data->CommandsType )
+            for( uint32_t i = 0; i < data->CommandsCount && ML_SUCCESS( log.m_Result ); ++i )
+            {
+                const uint32_t offset = buffer.m_Usage;
+
+                log.m_Result = Write( buffer, data->Commands[i] );
+
+                StoreBatchCommand( *data, i, offset, buffer.m_Usage - offset );
+            }
+
+            if( ML_SUCCESS( log.m_Result ) )
+            {
+                buffer.GetSizeRequirements( *size );
+
+                // Print output values.
+                log.Output( *size );
+            }
+            else
+            {
+                ML_ASSERT_ALWAYS();
+            }
+
+            return log.m_Result;
+        }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Writes library object commands to command buffer.
+        /// @param  buffer  target command buffer.
+        /// @param  data    command buffer data.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename CommandBuffer>
+        ML_INLINE static StatusCode Write(
+            CommandBuffer&               buffer,
+            const CommandBufferData_1_0& data )
+        {
+            switch( data.CommandsType )
             {
                 case ObjectType::QueryHwCounters:
-                    log.m_Result = T::Queries::HwCounters::Write( buffer, data->Allocation, data->QueryHwCounters );
-                    break;
+                    return T::Queries::HwCounters::Write( buffer, data.Allocation, data.QueryHwCounters );
 
                 case ObjectType::QueryHwCountersCopyReports:
-                    log.m_Result = T::Queries::HwCounters::CopyReports( buffer, data->QueryHwCountersCopyReports );
-                    break;
+                    return T::Queries::HwCounters::CopyReports( buffer, data.QueryHwCountersCopyReports );
 
                 case ObjectType::OverrideUser:
-                    log.m_Result = T::Overrides::User::Write( buffer, data->Override );
-                    break;
-
-                case ObjectType::OverrideNullHardware:
-                    log.m_Result = T::Overrides::NullHardware::Write( buffer, data->Override.Enable );
-                    break;
+                    return T::Overrides::User::Write( buffer, data.Override );
 
                 case ObjectType::OverrideFlushCaches:
-                    log.m_Result = T::Overrides::FlushCaches::Write( buffer );
-                    break;
+                    return T::Overrides::FlushCaches::Write( buffer );
+
+                case ObjectType::OverrideNullHardware:
+                    return T::Overrides::NullHardware::Write( buffer, data.Override.Enable );
 
                 case ObjectType::MarkerStreamUser:
-                    log.m_Result = T::Markers::StreamUser::Write( buffer, data->MarkerStreamUser );
-                    break;
+                    return T::Markers::StreamUser::Write( buffer, data.MarkerStreamUser );
 
                 case ObjectType::MarkerStreamUserExtended:
-                    log.m_Result = T::Markers::StreamUserExtended::Write( buffer, data->MarkerStreamUserExtended );
-                    break;
+                    return T::Markers::StreamUserExtended::Write( buffer, data.MarkerStreamUserExtended );
 
                 default:
-                    ML_ASSERT_ALWAYS();
-                    log.m_Result = StatusCode::IncorrectObject;
-                    break;
+                    ML_ASSERT_ALWAYS_ADAPTER( buffer.m_Context.m_AdapterId );
+                    return StatusCode::IncorrectObject;
             }
+        }
 
-            if( ML_SUCCESS( log.m_Result ) )
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Stores batched command offset and size if requested.
+        /// @param  data    batched command buffer data.
+        /// @param  index   command index.
+        /// @param  offset  command offset from the command buffer beginning.
+        /// @param  size    command size.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static void StoreBatchCommand(
+            const CommandBufferBatchData_1_1& data,
+            const uint32_t                    index,
+            const uint32_t                    offset,
+            const uint32_t                    size )
+        {
+            if( data.Offsets != nullptr )
             {
-                buffer.GetSizeRequirements( *size );
-
-                // Print output values.
-                log.Output( *size );
+                data.Offsets[index] = offset;
             }
-            else
+
+            if( data.Sizes != nullptr )
             {
-                ML_ASSERT_ALWAYS();
+                data.Sizes[index] = size;
             }
-
-            return log.m_Result;
         }
     };
 } // namespace ML
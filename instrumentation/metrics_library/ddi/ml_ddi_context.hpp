@@ -113,6 +113,21 @@ namespace ML
                     value->ValueUInt32 = sizeof( TT::Layouts::HwCounters::Query::ReportGpu );
                     break;
 
+                case ParameterType::QueryHwCountersReportApiCountersCount:
+                    *type              = ValueType::Uint32;
+                    value->ValueUInt32 = T::Queries::HwCounters::GetCompactCountersCount();
+                    break;
+
+                case ParameterType::QueryHwCountersReportApiCompactHeaderSize:
+                    *type              = ValueType::Uint32;
+                    value->ValueUInt32 = sizeof( TT::Layouts::HwCounters::Query::ReportApiCompact );
+                    break;
+
+                case ParameterType::QueryHwCountersReportGpuStatusSize:
+                    *type              = ValueType::Uint32;
+                    value->ValueUInt32 = sizeof( uint64_t ); // End tag.
+                    break;
+
                 case ParameterType::LibraryBuildNumber:
                     *type              = ValueType::Uint32;
                     value->ValueUInt32 = METRICS_LIBRARY_BUILD_NUMBER;
@@ -49,6 +49,7 @@ namespace ML
             switch( createData->Type )
             {
                 case ObjectType::QueryHwCounters:
+                case ObjectType::QueryHwCountersStatusArray:
                     log.m_Result = T::Queries::HwCounters::Create( *createData, *handle );
                     break;
 
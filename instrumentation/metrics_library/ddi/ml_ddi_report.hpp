@@ -51,6 +51,73 @@ namespace ML
 
                     return log.m_Result;
                 }
+                case ObjectType::QueryHwCountersMultisampled:
+                {
+                    auto& context = T::Queries::HwCounters::FromHandle( data->QueryMultisampled.Handle ).m_Context;
+                    ML_FUNCTION_LOG( StatusCode::Success, &context );
+
+                    // Print input values.
+                    log.Input( *data );
+
+                    log.m_Result = T::Queries::HwCounters::GetDataMultisampled( data->QueryMultisampled );
+                    ML_ASSERT( log.m_Result == StatusCode::Success || log.m_Result == StatusCode::ReportNotReady );
+
+                    return log.m_Result;
+                }
+                case ObjectType::QueryHwCountersCompact:
+                {
+                    auto& context = T::Queries::HwCounters::FromHandle( data->QueryCompact.Handle ).m_Context;
+                    ML_FUNCTION_LOG( StatusCode::Success, &context );
+
+                    // Print input values.
+                    log.Input( *data );
+
+                    log.m_Result = T::Queries::HwCounters::GetDataCompact( data->QueryCompact );
+                    ML_ASSERT( log.m_Result == StatusCode::Success || log.m_Result == StatusCode::ReportNotReady );
+
+                    return log.m_Result;
+                }
+                case ObjectType::QueryHwCountersColumns:
+                {
+                    auto& context = T::Queries::HwCounters::FromHandle( data->QueryColumns.Handle ).m_Context;
+                    ML_FUNCTION_LOG( StatusCode::Success, &context );
+
+                    // Print input values.
+                    log.Input( *data );
+
+                    log.m_Result = T::Queries::HwCounters::GetDataColumns( data->QueryColumns );
+                    ML_ASSERT( log.m_Result == StatusCode::Success || log.m_Result == StatusCode::ReportNotReady );
+
+                    return log.m_Result;
+                }
+                case ObjectType::QueryHwCountersReadiness:
+                {
+                    auto& context = T::Queries::HwCounters::FromHandle( data->QueryReadiness.Handle ).m_Context;
+                    ML_FUNCTION_LOG( StatusCode::Success, &context );
+
+                    // Print input values.
+                    log.Input( *data );
+
+                    log.m_Result = T::Queries::HwCounters::GetDataReadiness( data->QueryReadiness );
+                    ML_ASSERT( log.m_Result == StatusCode::Success );
+
+                    return log.m_Result;
+                }
+                case ObjectType::QueryHwCountersAsync:
+                {
+                    ML_FUNCTION_CHECK_STATIC( T::Context::IsValid( data->QueryAsync.Handle ) );
+
+                    auto& context = T::Context::FromHandle( data->QueryAsync.Handle );
+                    ML_FUNCTION_LOG( StatusCode::Success, &context );
+
+                    // Print input values.
+                    log.Input( *data );
+
+                    log.m_Result = T::Queries::HwCountersResolver::GetData( data->QueryAsync );
+                    ML_ASSERT( log.m_Result == StatusCode::Success );
+
+                    return log.m_Result;
+                }
                 case ObjectType::OverrideUser:
                 {
                     auto& context = T::Overrides::User::FromHandle( data->Override.Handle ).m_Context;
@@ -0,0 +1,1058 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2026 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+/*
+@file ml_bench.cpp
+
+@brief Measures CommandBufferGetSize_1_0, CommandBufferGet_1_0 and GetData_1_0
+       of XeHPG / oneApi Metrics Library against a synthetic drm and oa
+       backend, so neither a gpu nor a kernel driver is needed.
+
+       Io control calls are answered by a synthetic device that maps an
+       anonymous oa buffer. Query commands written by the library are
+       executed by a synthetic gpu that stores registers and immediate data
+       to query memory and appends triggered and timer reports to the oa
+       buffer. Reports time per slot, reports scanned per second and
+       allocations per call.
+
+Usage:              ml_bench [slots count] [iterations]
+*/
+
+#include "ml_pch.h"
+#include "ml_traits_include.h"
+
+#include <iostream>
+
+namespace
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Allocations made by operator new since the process start.
+    //////////////////////////////////////////////////////////////////////////
+    std::atomic<uint64_t> g_Allocations = 0;
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Counting replacements of global allocation functions.
+//////////////////////////////////////////////////////////////////////////
+void* operator new( size_t size )
+{
+    g_Allocations.fetch_add( 1, std::memory_order_relaxed );
+
+    if( void* memory = malloc( size ? size : 1 ) )
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new(
+    size_t size,
+    const std::nothrow_t& ) noexcept
+{
+    g_Allocations.fetch_add( 1, std::memory_order_relaxed );
+
+    return malloc( size ? size : 1 );
+}
+
+void operator delete( void* memory ) noexcept
+{
+    free( memory );
+}
+
+void operator delete(
+    void* memory,
+    size_t ) noexcept
+{
+    free( memory );
+}
+
+namespace ML
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Synthetic device state shared by io control and gpu emulation.
+    //////////////////////////////////////////////////////////////////////////
+    struct SyntheticDevice
+    {
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Constants.
+        //////////////////////////////////////////////////////////////////////////
+        static constexpr int32_t  m_Stream             = 0x7FFF;     // Tbs stream id, never used as a file descriptor.
+        static constexpr int32_t  m_MetricSet          = 1;          // Metric set activated by metrics discovery.
+        static constexpr int32_t  m_ChipsetId          = 0x56A0;     // Dg2 device id.
+        static constexpr uint32_t m_OaBufferGpuAddress = 0x00400000; // Oa buffer ggtt address.
+        static constexpr uint32_t m_OaBufferSize       = static_cast<uint32_t>( 16 * Constants::Data::m_Megabyte );
+        static constexpr uint64_t m_TimestampFrequency = 19200000;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Members.
+        //////////////////////////////////////////////////////////////////////////
+        uint8_t* m_OaBuffer;     // Mapped oa buffer, unmapped by the library.
+        uint32_t m_OaTailOffset; // Offset of the next report written by gpu.
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns synthetic device instance.
+        /// @return synthetic device.
+        //////////////////////////////////////////////////////////////////////////
+        static SyntheticDevice& GetInstance()
+        {
+            static SyntheticDevice instance = {};
+            return instance;
+        }
+    };
+} // namespace ML
+
+namespace ML::XE_HPG::OneApi
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Io control answered by the synthetic device. Declared before
+    ///        XeHPG / oneApi traits, so they use it instead of the kernel one.
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct IoControlTrait : XE_HPG::IoControlTrait<T>
+    {
+        ML_DECLARE_TRAIT( IoControlTrait, XE_HPG );
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Types.
+        //////////////////////////////////////////////////////////////////////////
+        using Base::m_DrmCard;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Initializes io control interface.
+        /// @param  clientData  initializing client data.
+        /// @return revision    drm performance revision.
+        /// @return             operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode Initialize(
+            [[maybe_unused]] const ClientData_1_0& clientData,
+            TT::ConstantsOs::Drm::Revision&        revision )
+        {
+            m_DrmCard = 0;
+            revision  = T::ConstantsOs::Drm::Revision::SubDevices;
+
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns metric set id activated by metrics discovery.
+        /// @return metric set id.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE int32_t GetKernelMetricSet() const
+        {
+            return SyntheticDevice::m_MetricSet;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns information about the file containing metric set id.
+        /// @return modificationTimestamp   time of last modification of the file.
+        /// @return indexNode               index node of the file.
+        /// @return                         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode GetKernelMetricSetInfo(
+            uint64_t& modificationTimestamp,
+            uint64_t& indexNode ) const
+        {
+            modificationTimestamp = 1;
+            indexNode             = 1;
+
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Creates dummy metric set configuration.
+        /// @return dummy metric set id.
+        //////////////////////////////////////////////////////////////////////////
+        template <bool isOaMert>
+        ML_INLINE int32_t CreateMetricSet() const
+        {
+            return SyntheticDevice::m_MetricSet;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Removes metric set configuration.
+        /// @return operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode RemoveMetricSet( [[maybe_unused]] int32_t set ) const
+        {
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Opens tbs stream.
+        /// @param  properties   tbs stream properties.
+        /// @return stream       opened tbs stream id.
+        /// @return              operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode OpenTbs(
+            [[maybe_unused]] std::vector<uint64_t>& properties,
+            int32_t&                                stream ) const
+        {
+            stream = SyntheticDevice::m_Stream;
+
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Closes tbs stream.
+        /// @return operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode CloseTbs( [[maybe_unused]] const int32_t stream ) const
+        {
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Sets new tbs metric set.
+        /// @return operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode SetTbsMetricSet(
+            [[maybe_unused]] const int32_t stream,
+            [[maybe_unused]] int32_t       set ) const
+        {
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns chipset id.
+        /// @return id  chipset id.
+        /// @return     operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode GetChipsetId( int32_t& id ) const
+        {
+            id = SyntheticDevice::m_ChipsetId;
+
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Maps an anonymous memory as oa buffer.
+        /// @return addressCpu  oa buffer cpu address.
+        /// @return size        oa buffer size.
+        /// @return             operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode MapOaBuffer(
+            [[maybe_unused]] const int32_t stream,
+            void*&                         addressCpu,
+            uint32_t&                      size ) const
+        {
+            auto& device = SyntheticDevice::GetInstance();
+
+            size       = SyntheticDevice::m_OaBufferSize;
+            addressCpu = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+            if( addressCpu == MAP_FAILED )
+            {
+                addressCpu = nullptr;
+                return StatusCode::TbsUnableToRead;
+            }
+
+            device.m_OaBuffer     = static_cast<uint8_t*>( addressCpu );
+            device.m_OaTailOffset = 0;
+
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns performance module revision.
+        /// @return revision performance module revision.
+        /// @return          operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode GetDrmRevision( TT::ConstantsOs::Drm::Revision& revision ) const
+        {
+            revision = T::ConstantsOs::Drm::Revision::SubDevices;
+
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Gets gpu timestamp frequency.
+        /// @return gpu timestamp frequency.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE uint64_t GetGpuTimestampFrequency( [[maybe_unused]] const TT::Layouts::Configuration::TimestampType timestampType ) const
+        {
+            return SyntheticDevice::m_TimestampFrequency;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Answers engine distance queries. All engines are local
+        ///         to the only memory region.
+        /// @param  query   query structure.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode Query( drm_i915_query& query ) const
+        {
+            auto items = reinterpret_cast<drm_i915_query_item*>( query.items_ptr );
+
+            for( uint32_t i = 0; i < query.num_items; ++i )
+            {
+                if( items[i].query_id != PRELIM_DRM_I915_QUERY_DISTANCE_INFO )
+                {
+                    return StatusCode::NotSupported;
+                }
+
+                reinterpret_cast<prelim_drm_i915_query_distance_info*>( items[i].data_ptr )->distance = 0;
+            }
+
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Answers engines and memory regions queries with a single
+        ///         render engine and a single system memory region.
+        /// @param  id      query id.
+        /// @return data    returned data.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode Query(
+            const uint32_t        id,
+            std::vector<uint8_t>& data ) const
+        {
+            switch( id )
+            {
+                case DRM_I915_QUERY_ENGINE_INFO:
+                {
+                    data.assign( sizeof( drm_i915_query_engine_info ) + sizeof( drm_i915_engine_info ), 0 );
+
+                    auto engines                               = reinterpret_cast<drm_i915_query_engine_info*>( data.data() );
+                    engines->num_engines                       = 1;
+                    engines->engines[0].engine.engine_class    = I915_ENGINE_CLASS_RENDER;
+                    engines->engines[0].engine.engine_instance = 0;
+
+                    return StatusCode::Success;
+                }
+
+                case DRM_I915_QUERY_MEMORY_REGIONS:
+                {
+                    data.assign( sizeof( drm_i915_query_memory_regions ) + sizeof( drm_i915_memory_region_info ), 0 );
+
+                    auto regions                               = reinterpret_cast<drm_i915_query_memory_regions*>( data.data() );
+                    regions->num_regions                       = 1;
+                    regions->regions[0].region.memory_class    = I915_MEMORY_CLASS_SYSTEM;
+                    regions->regions[0].region.memory_instance = 0;
+
+                    return StatusCode::Success;
+                }
+
+                default:
+                    return StatusCode::NotSupported;
+            }
+        }
+    };
+} // namespace ML::XE_HPG::OneApi
+
+#include "ml_traits_xe_hpg.h"
+#include "ml_ddi_command_buffer.hpp"
+#include "ml_ddi_configuration.hpp"
+#include "ml_ddi_context.hpp"
+#include "ml_ddi_marker.hpp"
+#include "ml_ddi_override.hpp"
+#include "ml_ddi_query.hpp"
+#include "ml_ddi_report.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief T is not available in this file.
+//////////////////////////////////////////////////////////////////////////
+#define T Traits
+
+namespace ML::XE_HPG::OneApi
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Instantiates XeHPG / oneApi entry points with synthetic io control.
+    //////////////////////////////////////////////////////////////////////////
+    StatusCode ML_STDCALL ContextCreate_1_0( ClientType_1_0 clientType, ContextCreateData_1_0* createData, ContextHandle_1_0* handle ) { return DdiContext<T>::ContextCreate_1_0( clientType, createData, handle ); }
+    StatusCode ML_STDCALL ContextDelete_1_0( const ContextHandle_1_0 handle ) { return DdiContext<T>::ContextDelete_1_0( handle ); }
+    StatusCode ML_STDCALL GetParameter_1_0( const ParameterType parameter, ValueType* type, TypedValue_1_0* value ) { return DdiContext<T>::GetParameter_1_0( parameter, type, value ); }
+    StatusCode ML_STDCALL CommandBufferGet_1_0( const CommandBufferData_1_0* data ) { return DdiCommandBuffer<T>::CommandBufferGet_1_0( data ); }
+    StatusCode ML_STDCALL CommandBufferGetSize_1_0( const CommandBufferData_1_0* data, CommandBufferSize_1_0* size ) { return DdiCommandBuffer<T>::CommandBufferGetSize_1_0( data, size ); }
+    StatusCode ML_STDCALL CommandBufferGetBatch_1_1( const CommandBufferBatchData_1_1* data ) { return DdiCommandBuffer<T>::CommandBufferGetBatch_1_1( data ); }
+    StatusCode ML_STDCALL CommandBufferGetBatchSize_1_1( const CommandBufferBatchData_1_1* data, CommandBufferSize_1_0* size ) { return DdiCommandBuffer<T>::CommandBufferGetBatchSize_1_1( data, size ); }
+    StatusCode ML_STDCALL QueryCreate_1_0( const QueryCreateData_1_0* createData, QueryHandle_1_0* handle ) { return DdiQuery<T>::QueryCreate_1_0( createData, handle ); }
+    StatusCode ML_STDCALL QueryDelete_1_0( const QueryHandle_1_0 handle ) { return DdiQuery<T>::QueryDelete_1_0( handle ); }
+    StatusCode ML_STDCALL OverrideCreate_1_0( const OverrideCreateData_1_0* createData, OverrideHandle_1_0* handle ) { return DdiOverride<T>::OverrideCreate_1_0( createData, handle ); }
+    StatusCode ML_STDCALL OverrideDelete_1_0( const OverrideHandle_1_0 handle ) { return DdiOverride<T>::OverrideDelete_1_0( handle ); }
+    StatusCode ML_STDCALL ConfigurationCreate_1_0( const ConfigurationCreateData_1_0* createData, ConfigurationHandle_1_0* handle ) { return DdiConfiguration<T>::ConfigurationCreate_1_0( createData, handle ); }
+    StatusCode ML_STDCALL ConfigurationActivate_1_0( const ConfigurationHandle_1_0 handle, const ConfigurationActivateData_1_0* activateData ) { return DdiConfiguration<T>::ConfigurationActivate_1_0( handle, activateData ); }
+    StatusCode ML_STDCALL ConfigurationDeactivate_1_0( const ConfigurationHandle_1_0 handle ) { return DdiConfiguration<T>::ConfigurationDeactivate_1_0( handle ); }
+    StatusCode ML_STDCALL ConfigurationDelete_1_0( const ConfigurationHandle_1_0 handle ) { return DdiConfiguration<T>::ConfigurationDelete_1_0( handle ); }
+    StatusCode ML_STDCALL GetData_1_0( GetReportData_1_0* data ) { return DdiReport<T>::GetData_1_0( data ); }
+    StatusCode ML_STDCALL MarkerCreate_1_0( const MarkerCreateData_1_0* createData, MarkerHandle_1_0* handle ) { return DdiMarker<T>::MarkerCreate_1_0( createData, handle ); }
+    StatusCode ML_STDCALL MarkerDelete_1_0( const MarkerHandle_1_0 handle ) { return DdiMarker<T>::MarkerDelete_1_0( handle ); }
+} // namespace ML::XE_HPG::OneApi
+
+#undef T
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief  Retrieves a function table for the benchmarked client type.
+/// @param  clientType  client type.
+/// @return             function table or nullptr for other client types.
+//////////////////////////////////////////////////////////////////////////
+const ML::DdiFunctionTableBase* GetFunctionTable( const ClientType_1_0& clientType )
+{
+    using namespace ML;
+
+    return clientType.Gen == ClientGen::XeHPG && clientType.Api == ClientApi::OneApi
+        ? &XE_HPG::OneApi::DdiFunctionTable<XE_HPG::OneApi::Traits>::GetInstance()
+        : nullptr;
+}
+
+namespace ML
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Traits used by benchmarks.
+    //////////////////////////////////////////////////////////////////////////
+    using BenchmarkTraits = XE_HPG::OneApi::Traits;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Synthetic gpu executing query commands written by the library.
+    //////////////////////////////////////////////////////////////////////////
+    struct SyntheticGpu
+    {
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Types.
+        //////////////////////////////////////////////////////////////////////////
+        using ReportOa      = BenchmarkTraits::Layouts::HwCounters::ReportOa;
+        using ReportReason  = BenchmarkTraits::Layouts::OaBuffer::ReportReason;
+        using Registers     = BenchmarkTraits::GpuRegisters;
+        using StoreData     = BenchmarkTraits::Layouts::GpuCommands::MI_STORE_DATA_IMM;
+        using LoadRegister  = BenchmarkTraits::Layouts::GpuCommands::MI_LOAD_REGISTER_IMM;
+        using StoreRegister = BenchmarkTraits::Layouts::GpuCommands::MI_STORE_REGISTER_MEM;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Members.
+        //////////////////////////////////////////////////////////////////////////
+        SyntheticDevice&                       m_Device;
+        uint8_t*                               m_MemoryCpu;  // Query memory.
+        uint64_t                               m_MemoryGpu;
+        uint64_t                               m_MemorySize;
+        std::unordered_map<uint32_t, uint32_t> m_Registers;  // Registers loaded by commands.
+        uint32_t                               m_Timestamp;  // Next oa report timestamp.
+        uint64_t                               m_Faults;     // Stores out of query memory.
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief SyntheticGpu constructor.
+        /// @param memoryCpu    query memory cpu address.
+        /// @param memoryGpu    query memory gpu address.
+        /// @param memorySize   query memory size.
+        //////////////////////////////////////////////////////////////////////////
+        SyntheticGpu(
+            uint8_t*       memoryCpu,
+            const uint64_t memoryGpu,
+            const uint64_t memorySize )
+            : m_Device( SyntheticDevice::GetInstance() )
+            , m_MemoryCpu( memoryCpu )
+            , m_MemoryGpu( memoryGpu )
+            , m_MemorySize( memorySize )
+            , m_Registers{}
+            , m_Timestamp( 0x1000 )
+            , m_Faults( 0 )
+        {
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Executes gpu commands.
+        /// @param  commands    gpu commands.
+        /// @param  size        gpu commands size.
+        //////////////////////////////////////////////////////////////////////////
+        void Execute(
+            const uint8_t* commands,
+            const uint32_t size )
+        {
+            constexpr uint32_t commandTypeMi = StoreData::COMMAND_TYPE_MI_COMMAND;
+
+            for( uint32_t offset = 0; offset + sizeof( uint32_t ) <= size; )
+            {
+                uint32_t header = 0;
+                BenchmarkTraits::Tools::MemoryCopy( &header, sizeof( header ), commands + offset, sizeof( header ) );
+
+                const uint32_t type    = header >> 29;
+                const uint32_t opcode  = ( header >> 23 ) & 0x3F;
+                const bool     noop    = type == commandTypeMi && opcode == 0;
+                const uint32_t length  = noop ? sizeof( uint32_t ) : ( ( header & 0xFF ) + 2 ) * sizeof( uint32_t );
+                const uint8_t* command = commands + offset;
+
+                if( type == commandTypeMi )
+                {
+                    switch( opcode )
+                    {
+                        case StoreData::MI_COMMAND_OPCODE_MI_STORE_DATA_IMM:
+                        {
+                            const auto     storeData = Decode<StoreData>( command, length );
+                            const uint32_t data[]    = { storeData.GetDataDWord0(), storeData.GetDataDWord1() };
+
+                            WriteMemory( storeData.GetAddress(), data, storeData.GetStoreQword() ? sizeof( uint64_t ) : sizeof( uint32_t ) );
+                            break;
+                        }
+
+                        case LoadRegister::MI_COMMAND_OPCODE_MI_LOAD_REGISTER_IMM:
+                        {
+                            const auto loadRegister = Decode<LoadRegister>( command, length );
+
+                            WriteRegister( static_cast<uint32_t>( loadRegister.GetRegisterOffset() ), static_cast<uint32_t>( loadRegister.GetDataDWord() ) );
+                            break;
+                        }
+
+                        case StoreRegister::MI_COMMAND_OPCODE_MI_STORE_REGISTER_MEM:
+                        {
+                            const auto     storeRegister = Decode<StoreRegister>( command, length );
+                            const uint32_t value         = ReadRegister( storeRegister.GetRegisterAddress() );
+
+                            WriteMemory( storeRegister.GetMemoryAddress(), &value, sizeof( value ) );
+                            break;
+                        }
+
+                        default:
+                            // Other commands do not change query memory.
+                            break;
+                    }
+                }
+
+                offset += length;
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Appends timer reports sampled during a workload.
+        /// @param  count   reports count.
+        //////////////////////////////////////////////////////////////////////////
+        void WriteTimerReports( const uint32_t count )
+        {
+            for( uint32_t i = 0; i < count; ++i )
+            {
+                WriteReport( ReportReason::Timer, 0 );
+            }
+        }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Copies a gpu command into its layout. Commands shorter than
+        ///         their layouts, like dword immediate stores, are zero padded.
+        /// @param  command gpu command.
+        /// @param  length  gpu command length.
+        /// @return         decoded gpu command.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename Command>
+        static Command Decode(
+            const uint8_t* command,
+            const uint32_t length )
+        {
+            Command decoded = {};
+
+            BenchmarkTraits::Tools::MemoryCopy( &decoded, sizeof( decoded ), command, std::min<uint32_t>( length, sizeof( decoded ) ) );
+
+            return decoded;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns register value. Oa registers reflect the oa buffer.
+        /// @param  offset  register offset.
+        /// @return         register value.
+        //////////////////////////////////////////////////////////////////////////
+        uint32_t ReadRegister( const uint32_t offset ) const
+        {
+            switch( offset )
+            {
+                case Registers::m_OaTail:
+                    return SyntheticDevice::m_OaBufferGpuAddress + m_Device.m_OaTailOffset;
+
+                case Registers::m_OaBuffer:
+                    return SyntheticDevice::m_OaBufferGpuAddress;
+
+                default:
+                {
+                    const auto found = m_Registers.find( offset );
+
+                    return found != m_Registers.end()
+                        ? found->second
+                        : 0;
+                }
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Loads register value. Oag trigger writes a triggered
+        ///         report with the loaded value as its context id.
+        /// @param  offset  register offset.
+        /// @param  value   register value.
+        //////////////////////////////////////////////////////////////////////////
+        void WriteRegister(
+            const uint32_t offset,
+            const uint32_t value )
+        {
+            if( offset == Registers::m_OagTrigger )
+            {
+                WriteReport( ReportReason::MmioTrigger, value );
+            }
+            else
+            {
+                m_Registers[offset] = value;
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Stores data to query memory.
+        /// @param  address gpu address.
+        /// @param  data    data to store.
+        /// @param  size    data size.
+        //////////////////////////////////////////////////////////////////////////
+        void WriteMemory(
+            const uint64_t address,
+            const void*    data,
+            const uint32_t size )
+        {
+            if( address < m_MemoryGpu || address + size > m_MemoryGpu + m_MemorySize )
+            {
+                ++m_Faults;
+                return;
+            }
+
+            BenchmarkTraits::Tools::MemoryCopy( m_MemoryCpu + ( address - m_MemoryGpu ), size, data, size );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Writes an oa report at oa buffer tail.
+        /// @param  reason      report reason.
+        /// @param  contextId   report context id.
+        //////////////////////////////////////////////////////////////////////////
+        void WriteReport(
+            const ReportReason reason,
+            const uint32_t     contextId )
+        {
+            constexpr uint32_t timestampStep = 100;
+
+            auto& report = *reinterpret_cast<ReportOa*>( m_Device.m_OaBuffer + m_Device.m_OaTailOffset );
+
+            report                                    = {};
+            report.m_Header.m_ReportId.m_ReportReason = static_cast<uint32_t>( reason );
+            report.m_Header.m_ContextId               = contextId;
+            report.m_Header.m_Timestamp               = m_Timestamp;
+            report.m_Header.m_GpuTicks                = m_Timestamp * 2;
+
+            m_Timestamp            += timestampStep;
+            m_Device.m_OaTailOffset = ( m_Device.m_OaTailOffset + sizeof( ReportOa ) ) % SyntheticDevice::m_OaBufferSize;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Benchmark runner.
+    //////////////////////////////////////////////////////////////////////////
+    struct Benchmark
+    {
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Types.
+        //////////////////////////////////////////////////////////////////////////
+        using ReportGpu = BenchmarkTraits::Layouts::HwCounters::Query::ReportGpu;
+        using ReportApi = BenchmarkTraits::Layouts::HwCounters::Query::ReportApi;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Benchmark measurement.
+        //////////////////////////////////////////////////////////////////////////
+        struct Measurement
+        {
+            uint64_t m_Nanoseconds;
+            uint64_t m_Allocations;
+            uint64_t m_Calls;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Constants.
+        //////////////////////////////////////////////////////////////////////////
+        static constexpr uint32_t m_TimerReportsPerSlot = 8;   // Timer reports sampled during a workload.
+        static constexpr uint32_t m_WorkloadSize        = 64;  // Gap between query begin and end commands.
+        static constexpr uint64_t m_MemoryGpu           = 0x100000000; // Query memory gpu address.
+        static constexpr uint64_t m_CommandsGpu         = 0x200000000; // Command buffer gpu address.
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Members.
+        //////////////////////////////////////////////////////////////////////////
+        uint32_t                m_SlotsCount;
+        uint32_t                m_Iterations;
+        ContextHandle_1_0       m_Context;
+        Interface_1_0           m_Api;
+        ConfigurationHandle_1_0 m_Configuration;
+        QueryHandle_1_0         m_Query;
+        uint32_t                m_ReportGpuSize;
+        uint32_t                m_ReportApiSize;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Benchmark constructor.
+        /// @param slotsCount   query slots used within a single iteration.
+        /// @param iterations   iterations count.
+        //////////////////////////////////////////////////////////////////////////
+        Benchmark(
+            const uint32_t slotsCount,
+            const uint32_t iterations )
+            : m_SlotsCount( slotsCount )
+            , m_Iterations( iterations )
+            , m_Context{}
+            , m_Api{}
+            , m_Configuration{}
+            , m_Query{}
+            , m_ReportGpuSize( 0 )
+            , m_ReportApiSize( 0 )
+        {
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Benchmark destructor.
+        //////////////////////////////////////////////////////////////////////////
+        ~Benchmark()
+        {
+            if( m_Query.IsValid() )
+            {
+                m_Api.QueryDelete( m_Query );
+            }
+
+            if( m_Configuration.IsValid() )
+            {
+                m_Api.ConfigurationDeactivate( m_Configuration );
+                m_Api.ConfigurationDelete( m_Configuration );
+            }
+
+            if( m_Context.IsValid() )
+            {
+                GetFunctionTable( GetClientType() )->pfnContextDelete_1_0( m_Context );
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Runs all benchmarks.
+        /// @return false if slots count exceeds oa buffer, the library cannot
+        ///         be initialized or reports are invalid.
+        //////////////////////////////////////////////////////////////////////////
+        bool Run()
+        {
+            // Two triggered reports and timer reports of each slot cannot wrap oa buffer.
+            constexpr uint32_t slotReportsSize = ( m_TimerReportsPerSlot + 2 ) * sizeof( SyntheticGpu::ReportOa );
+            constexpr uint32_t maxSlotsCount   = SyntheticDevice::m_OaBufferSize / slotReportsSize - 1;
+
+            if( m_SlotsCount > maxSlotsCount )
+            {
+                std::cerr << "Slots count should not exceed " << maxSlotsCount << '\n';
+                return false;
+            }
+
+            if( !Initialize() )
+            {
+                return false;
+            }
+
+            const uint64_t memorySize = static_cast<uint64_t>( m_ReportGpuSize ) * m_SlotsCount;
+            const uint32_t stride     = 2 * GetCommandsSize() + m_WorkloadSize;
+
+            auto memory   = std::vector<uint8_t>( memorySize );
+            auto commands = std::vector<uint8_t>( static_cast<size_t>( stride ) * m_SlotsCount );
+            auto reports  = std::vector<uint8_t>( static_cast<size_t>( m_ReportApiSize ) * m_SlotsCount );
+            auto gpu      = SyntheticGpu( memory.data(), m_MemoryGpu, memorySize );
+
+            auto commandBuffer                   = CommandBufferData_1_0{};
+            commandBuffer.HandleContext          = m_Context;
+            commandBuffer.CommandsType           = ObjectType::QueryHwCounters;
+            commandBuffer.Type                   = GpuCommandBufferType::Render;
+            commandBuffer.Allocation             = { m_MemoryGpu, memory.data(), {} };
+            commandBuffer.QueryHwCounters        = {};
+            commandBuffer.QueryHwCounters.Handle = m_Query;
+
+            auto getData             = GetReportData_1_0{};
+            getData.Type             = ObjectType::QueryHwCounters;
+            getData.Query.Handle     = m_Query;
+            getData.Query.Slot       = 0;
+            getData.Query.SlotsCount = m_SlotsCount;
+            getData.Query.DataSize   = static_cast<uint32_t>( reports.size() );
+            getData.Query.Data       = reports.data();
+
+            Measurement getSizeMeasurement = {};
+            Measurement getMeasurement     = {};
+            Measurement getDataMeasurement = {};
+            uint64_t    scannedReports     = 0;
+            uint32_t    beginSize          = 0;
+            uint32_t    endSize            = 0;
+            bool        valid              = true;
+
+            for( uint32_t iteration = 0; iteration < m_Iterations && valid; ++iteration )
+            {
+                commandBuffer.QueryHwCounters.EndTag = iteration + 1;
+
+                // Command buffer sizes.
+                Measure( getSizeMeasurement, 2 * m_SlotsCount, [&]()
+                    {
+                        for( uint32_t slot = 0; slot < m_SlotsCount; ++slot )
+                        {
+                            auto size = CommandBufferSize_1_0{};
+
+                            commandBuffer.QueryHwCounters.Slot  = slot;
+                            commandBuffer.QueryHwCounters.Begin = true;
+                            valid &= ML_SUCCESS( m_Api.CommandBufferGetSize( &commandBuffer, &size ) );
+                            beginSize = size.GpuMemorySize;
+
+                            commandBuffer.QueryHwCounters.Begin = false;
+                            valid &= ML_SUCCESS( m_Api.CommandBufferGetSize( &commandBuffer, &size ) );
+                            endSize = size.GpuMemorySize;
+                        }
+                    } );
+
+                // Query begin and end commands of each slot, separated by a workload.
+                Measure( getMeasurement, 2 * m_SlotsCount, [&]()
+                    {
+                        for( uint32_t slot = 0; slot < m_SlotsCount; ++slot )
+                        {
+                            uint8_t* begin = commands.data() + static_cast<size_t>( stride ) * slot;
+
+                            commandBuffer.QueryHwCounters.Slot  = slot;
+                            commandBuffer.QueryHwCounters.Begin = true;
+                            commandBuffer.Data                  = begin;
+                            commandBuffer.Size                  = stride;
+                            valid &= ML_SUCCESS( m_Api.CommandBufferGet( &commandBuffer ) );
+
+                            commandBuffer.QueryHwCounters.Begin = false;
+                            commandBuffer.Data                  = begin + beginSize + m_WorkloadSize;
+                            commandBuffer.Size                  = stride - beginSize - m_WorkloadSize;
+                            valid &= ML_SUCCESS( m_Api.CommandBufferGet( &commandBuffer ) );
+                        }
+                    } );
+
+                // Gpu execution, not measured.
+                for( uint32_t slot = 0; slot < m_SlotsCount; ++slot )
+                {
+                    const uint8_t* begin = commands.data() + static_cast<size_t>( stride ) * slot;
+
+                    gpu.Execute( begin, beginSize );
+                    gpu.WriteTimerReports( m_TimerReportsPerSlot );
+                    gpu.Execute( begin + beginSize + m_WorkloadSize, endSize );
+
+                    scannedReports += GetScannedReports( memory.data() + static_cast<size_t>( m_ReportGpuSize ) * slot );
+                }
+
+                // Reports.
+                Measure( getDataMeasurement, 1, [&]()
+                    {
+                        valid &= ML_SUCCESS( m_Api.GetData( &getData ) );
+                    } );
+
+                valid = valid && ValidateReports( reports.data() );
+            }
+
+            if( !valid || gpu.m_Faults )
+            {
+                std::cerr << "Invalid query commands or reports, faults " << gpu.m_Faults << '\n';
+                return false;
+            }
+
+            const uint64_t slots = static_cast<uint64_t>( m_SlotsCount ) * m_Iterations;
+
+            std::cout << std::left << std::setw( 36 ) << "benchmark"
+                      << std::right << std::setw( 14 ) << "ns/item"
+                      << std::setw( 18 ) << "items/s"
+                      << std::setw( 14 ) << "allocs/call"
+                      << "  item\n";
+
+            Print( "CommandBufferGetSize_1_0", getSizeMeasurement, slots, "slot" );
+            Print( "CommandBufferGet_1_0", getMeasurement, slots, "slot" );
+            Print( "GetData_1_0", getDataMeasurement, slots, "slot" );
+            Print( "GetData_1_0", getDataMeasurement, scannedReports, "report scanned" );
+
+            return true;
+        }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns benchmarked client type.
+        /// @return client type.
+        //////////////////////////////////////////////////////////////////////////
+        static ClientType_1_0 GetClientType()
+        {
+            return { ClientApi::OneApi, ClientGen::XeHPG };
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Creates context, activates oa configuration and creates query.
+        /// @return true if succeeded.
+        //////////////////////////////////////////////////////////////////////////
+        bool Initialize()
+        {
+            auto clientType      = GetClientType();
+            auto clientData      = ClientData_1_0{};
+            auto clientCallbacks = ClientCallbacks_1_0{};
+            auto createData      = ContextCreateData_1_0{ &clientData, &clientCallbacks, &m_Api };
+
+            if( ML_FAIL( GetFunctionTable( clientType )->pfnContextCreate_1_0( clientType, &createData, &m_Context ) ) )
+            {
+                std::cerr << "Cannot create context\n";
+                return false;
+            }
+
+            auto type  = ValueType::Last;
+            auto value = TypedValue_1_0{};
+
+            const bool validGpuSize = ML_SUCCESS( m_Api.GetParameter( ParameterType::QueryHwCountersReportGpuSize, &type, &value ) );
+            m_ReportGpuSize         = value.ValueUInt32;
+
+            const bool validApiSize = ML_SUCCESS( m_Api.GetParameter( ParameterType::QueryHwCountersReportApiSize, &type, &value ) );
+            m_ReportApiSize         = value.ValueUInt32;
+
+            auto configurationData = ConfigurationCreateData_1_0{ m_Context, ObjectType::ConfigurationHwCountersOa };
+            auto activateData      = ConfigurationActivateData_1_0{ GpuConfigurationActivationType::Tbs };
+            auto queryData         = QueryCreateData_1_0{ m_Context, ObjectType::QueryHwCounters, m_SlotsCount };
+
+            const bool validConfiguration = ML_SUCCESS( m_Api.ConfigurationCreate( &configurationData, &m_Configuration ) ) &&
+                ML_SUCCESS( m_Api.ConfigurationActivate( m_Configuration, &activateData ) );
+
+            const bool validQuery = ML_SUCCESS( m_Api.QueryCreate( &queryData, &m_Query ) );
+
+            if( !validGpuSize || !validApiSize || !validConfiguration || !validQuery )
+            {
+                std::cerr << "Cannot create oa configuration or query\n";
+                return false;
+            }
+
+            return true;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns the largest command buffer size of query begin and end.
+        /// @return command buffer size.
+        //////////////////////////////////////////////////////////////////////////
+        uint32_t GetCommandsSize() const
+        {
+            auto commandBuffer                   = CommandBufferData_1_0{};
+            auto size                            = CommandBufferSize_1_0{};
+            uint32_t result                      = 0;
+            commandBuffer.HandleContext          = m_Context;
+            commandBuffer.CommandsType           = ObjectType::QueryHwCounters;
+            commandBuffer.Type                   = GpuCommandBufferType::Render;
+            commandBuffer.QueryHwCounters        = {};
+            commandBuffer.QueryHwCounters.Handle = m_Query;
+
+            for( const bool begin : { true, false } )
+            {
+                commandBuffer.QueryHwCounters.Begin = begin;
+                m_Api.CommandBufferGetSize( &commandBuffer, &size );
+                result = std::max( result, size.GpuMemorySize );
+            }
+
+            return result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns oa reports count between query begin and end
+        ///         scanned by GetData.
+        /// @param  report  query slot gpu report.
+        /// @return         oa reports count.
+        //////////////////////////////////////////////////////////////////////////
+        static uint32_t GetScannedReports( const uint8_t* report )
+        {
+            const auto&    reportGpu = *reinterpret_cast<const ReportGpu*>( report );
+            const uint32_t begin     = reportGpu.m_OaTailPreBegin.GetOffset();
+            const uint32_t end       = reportGpu.m_OaTailPostEnd.GetOffset();
+            const uint32_t size      = SyntheticDevice::m_OaBufferSize;
+
+            return ( end + size - begin ) % size / sizeof( SyntheticGpu::ReportOa );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Validates api reports of all slots.
+        /// @param  reports api reports.
+        /// @return         true if all reports are valid.
+        //////////////////////////////////////////////////////////////////////////
+        bool ValidateReports( const uint8_t* reports ) const
+        {
+            for( uint32_t slot = 0; slot < m_SlotsCount; ++slot )
+            {
+                const auto& flags = reinterpret_cast<const ReportApi*>( reports + static_cast<size_t>( m_ReportApiSize ) * slot )->m_Flags;
+
+                if( flags.m_ReportNotReady || flags.m_ReportLost || flags.m_ReportInconsistent ||
+                    flags.m_ReportWithoutWorkload || flags.m_ContextMismatch || flags.m_ReportContextSwitchLost )
+                {
+                    std::cerr << "Invalid report of slot " << slot << '\n';
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Measures time and allocations of a call.
+        /// @param  measurement accumulated measurement.
+        /// @param  calls       api calls made by the call.
+        /// @param  call        benchmarked call.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename Call>
+        static void Measure(
+            Measurement&   measurement,
+            const uint32_t calls,
+            Call&&         call )
+        {
+            const uint64_t allocations = g_Allocations.load( std::memory_order_relaxed );
+            const auto     begin       = std::chrono::steady_clock::now();
+
+            call();
+
+            const auto end = std::chrono::steady_clock::now();
+
+            measurement.m_Nanoseconds += static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( end - begin ).count() );
+            measurement.m_Allocations += g_Allocations.load( std::memory_order_relaxed ) - allocations;
+            measurement.m_Calls       += calls;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Prints out a benchmark result line.
+        /// @param name         benchmark name.
+        /// @param measurement  benchmark measurement.
+        /// @param items        processed items count.
+        /// @param item         item description.
+        //////////////////////////////////////////////////////////////////////////
+        static void Print(
+            const char*        name,
+            const Measurement& measurement,
+            const uint64_t     items,
+            const char*        item )
+        {
+            const double nanoseconds = static_cast<double>( measurement.m_Nanoseconds );
+            const double count       = static_cast<double>( items ? items : 1 );
+            const double calls       = static_cast<double>( measurement.m_Calls ? measurement.m_Calls : 1 );
+
+            std::cout << std::left << std::setw( 36 ) << name
+                      << std::right << std::fixed << std::setprecision( 2 )
+                      << std::setw( 14 ) << nanoseconds / count
+                      << std::setw( 18 ) << std::setprecision( 0 ) << ( nanoseconds ? count * 1e9 / nanoseconds : 0.0 )
+                      << std::setw( 14 ) << std::setprecision( 2 ) << static_cast<double>( measurement.m_Allocations ) / calls
+                      << "  " << item << '\n';
+        }
+    };
+} // namespace ML
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief  Runs benchmarks for optional slots and iterations counts.
+/// @return process exit code.
+//////////////////////////////////////////////////////////////////////////
+int main(
+    int    argc,
+    char** argv )
+{
+    if( argc > 3 )
+    {
+        std::cerr << "Usage: " << argv[0] << " [slots count] [iterations]\n";
+        return EXIT_FAILURE;
+    }
+
+    const uint32_t slotsCount = argc > 1 ? static_cast<uint32_t>( strtoul( argv[1], nullptr, 10 ) ) : 1024;
+    const uint32_t iterations = argc > 2 ? static_cast<uint32_t>( strtoul( argv[2], nullptr, 10 ) ) : 16;
+
+    if( slotsCount == 0 || iterations == 0 )
+    {
+        std::cerr << "Slots and iterations counts should be greater than zero\n";
+        return EXIT_FAILURE;
+    }
+
+    ML::Benchmark benchmark( slotsCount, iterations );
+
+    return benchmark.Run()
+        ? EXIT_SUCCESS
+        : EXIT_FAILURE;
+}
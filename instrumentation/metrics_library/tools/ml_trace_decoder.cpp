@@ -0,0 +1,345 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2026 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+/*
+@file ml_trace_decoder.cpp
+
+@brief Prints out a binary trace file written by Metrics Library when
+       IU_DBG_BINARY_TRACE log flag is set. Values are formatted with
+       the same debug helper functions as text logs.
+
+Usage:              ml_trace_decoder MetricsLibrary_trace_<time>_<pid>.bin
+*/
+
+#include "ml_pch.h"
+#include "ml_traits_include.h"
+
+#include <iostream>
+
+namespace ML
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Binary trace decoder.
+    //////////////////////////////////////////////////////////////////////////
+    struct TraceDecoder : TraceBase
+    {
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Members.
+        //////////////////////////////////////////////////////////////////////////
+        std::vector<Record>                       m_Records;
+        std::unordered_map<uint64_t, std::string> m_Names; // Function names by function ids.
+        uint64_t                                  m_FirstTimestamp;
+        DebugBase                                 m_Debug;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief TraceDecoder constructor.
+        //////////////////////////////////////////////////////////////////////////
+        TraceDecoder()
+            : m_Records{}
+            , m_Names{}
+            , m_FirstTimestamp( 0 )
+            , m_Debug{}
+        {
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Reads trace file records.
+        /// @param  fileName    trace file name.
+        /// @return             true if the file is a valid trace file.
+        //////////////////////////////////////////////////////////////////////////
+        bool Open( const char* fileName )
+        {
+            std::ifstream file( fileName, std::ios::binary | std::ios::ate );
+
+            if( !file.is_open() )
+            {
+                std::cerr << "Cannot open " << fileName << '\n';
+                return false;
+            }
+
+            const std::streamsize fileSize = file.tellg();
+            file.seekg( 0 );
+
+            m_Records.resize( static_cast<size_t>( fileSize ) / sizeof( Record ) );
+            file.read( reinterpret_cast<char*>( m_Records.data() ), m_Records.size() * sizeof( Record ) );
+
+            FileEntry header = {};
+
+            if( m_Records.empty() || !Read( 0, 0, header ) || header.m_Kind != EntryKind::File ||
+                std::string( header.m_Magic ) != Constants::Trace::m_Magic ||
+                header.m_Version != Constants::Trace::m_Version ||
+                header.m_RecordSize != sizeof( Record ) )
+            {
+                std::cerr << fileName << " is not a supported trace file\n";
+                return false;
+            }
+
+            return true;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Prints out all trace entries.
+        //////////////////////////////////////////////////////////////////////////
+        void Print()
+        {
+            uint32_t index = 0;
+
+            while( index < m_Records.size() )
+            {
+                struct
+                {
+                    EntryKind m_Kind;
+                    uint32_t  m_RecordsCount;
+                } header = {};
+
+                Read( index, 0, header );
+
+                if( header.m_RecordsCount == 0 || index + header.m_RecordsCount > m_Records.size() )
+                {
+                    std::cerr << "Trace file is truncated\n";
+                    return;
+                }
+
+                switch( header.m_Kind )
+                {
+                    case EntryKind::Name:
+                        ReadName( index );
+                        break;
+
+                    case EntryKind::Message:
+                        PrintMessage( index );
+                        break;
+
+                    case EntryKind::Dropped:
+                        PrintDropped( index );
+                        break;
+
+                    default:
+                        break;
+                }
+
+                index += header.m_RecordsCount;
+            }
+        }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Copies bytes from an entry.
+        /// @param  index   entry first record index.
+        /// @param  offset  offset from the entry beginning.
+        /// @param  target  target memory.
+        /// @param  size    bytes count.
+        /// @return         false if bytes are out of the file.
+        //////////////////////////////////////////////////////////////////////////
+        bool Read(
+            const uint32_t index,
+            const size_t   offset,
+            void*          target,
+            const size_t   size ) const
+        {
+            const size_t begin = index * sizeof( Record ) + offset;
+
+            if( begin + size > m_Records.size() * sizeof( Record ) )
+            {
+                return false;
+            }
+
+            return iu_memcpy_s( target, size, reinterpret_cast<const uint8_t*>( m_Records.data() ) + begin, size );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Copies a structure from an entry.
+        /// @param  index   entry first record index.
+        /// @param  offset  offset from the entry beginning.
+        /// @return value   read structure.
+        /// @return         false if bytes are out of the file.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename Value>
+        bool Read(
+            const uint32_t index,
+            const size_t   offset,
+            Value&         value ) const
+        {
+            return Read( index, offset, &value, sizeof( value ) );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Stores a function name.
+        /// @param index    entry first record index.
+        //////////////////////////////////////////////////////////////////////////
+        void ReadName( const uint32_t index )
+        {
+            NameEntry   name = {};
+            std::string text;
+
+            Read( index, 0, name );
+            text.resize( name.m_Length );
+            Read( index, sizeof( name ), text.data(), text.size() );
+
+            m_Names[name.m_FunctionId] = text;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Prints out a log message, each line of its values separately.
+        /// @param index    entry first record index.
+        //////////////////////////////////////////////////////////////////////////
+        void PrintMessage( const uint32_t index )
+        {
+            MessageEntry message = {};
+            size_t       offset  = sizeof( message );
+            std::string  text;
+
+            Read( index, 0, message );
+
+            for( uint32_t i = 0; i < message.m_ValuesCount; ++i )
+            {
+                ValueEntry value = {};
+
+                if( !Read( index, offset, value ) )
+                {
+                    break;
+                }
+
+                const uint32_t       dataSize = ( value.m_TypeId == m_TypeOpaque ) ? 0 : value.m_Size;
+                std::vector<uint8_t> data( dataSize );
+
+                offset += sizeof( value );
+                Read( index, offset, data.data(), dataSize );
+                offset += ( dataSize + 7 ) & ~7u;
+
+                const std::string valueText = ValueToString( m_Debug, value.m_TypeId, data.data(), value.m_Size );
+
+                if( i > 0 && !valueText.empty() )
+                {
+                    // Single space has been added to avoid arguments concatenation.
+                    text += ' ';
+                }
+
+                text += valueText;
+            }
+
+            if( m_FirstTimestamp == 0 )
+            {
+                m_FirstTimestamp = message.m_Timestamp;
+            }
+
+            const auto         name   = m_Names.find( message.m_FunctionId );
+            const std::string  prefix = GetPrefix( message, name != m_Names.end() ? name->second : m_Debug.ToString( reinterpret_cast<const void*>( static_cast<uintptr_t>( message.m_FunctionId ) ) ) );
+            std::istringstream stream( text );
+            std::string        line;
+
+            while( std::getline( stream, line ) )
+            {
+                std::cout << prefix << line << '\n';
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Prints out dropped messages count.
+        /// @param index    entry first record index.
+        //////////////////////////////////////////////////////////////////////////
+        void PrintDropped( const uint32_t index )
+        {
+            DroppedEntry dropped = {};
+
+            Read( index, 0, dropped );
+
+            std::cout << "[ThreadId:" << dropped.m_ThreadId << "] " << dropped.m_DroppedCount << " messages dropped, trace ring was full\n";
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns a log line prefix similar to text logs.
+        /// @param  message         log message.
+        /// @param  functionName    function name.
+        /// @return                 log line prefix.
+        //////////////////////////////////////////////////////////////////////////
+        std::string GetPrefix(
+            const MessageEntry& message,
+            const std::string&  functionName ) const
+        {
+            std::ostringstream output;
+            const double       time = static_cast<double>( message.m_Timestamp - m_FirstTimestamp ) / 1000.0;
+
+            output << '[' << std::fixed << std::setprecision( 3 ) << std::setw( 14 ) << time << "us]";
+            output << "[ThreadId:" << message.m_ThreadId << ']';
+
+            if( message.m_AdapterId == IU_ADAPTER_ID_UNKNOWN )
+            {
+                output << "(A?)";
+            }
+            else
+            {
+                output << "(A" << message.m_AdapterId << ')';
+            }
+
+            output << ':' << GetTag( message.m_LogType ) << ':' << functionName << ": ";
+
+            return output.str();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns a log type tag.
+        /// @param  type    log type.
+        /// @return         log type tag.
+        //////////////////////////////////////////////////////////////////////////
+        static const char* GetTag( const LogType type )
+        {
+            switch( type )
+            {
+                case LogType::Critical:
+                    return "C";
+                case LogType::Error:
+                    return "E";
+                case LogType::Warning:
+                    return "W";
+                case LogType::Info:
+                    return "I";
+                case LogType::Debug:
+                    return "D";
+                case LogType::Traits:
+                    return "T";
+                case LogType::Entered:
+                    return "Enter";
+                case LogType::Exiting:
+                    return "Exit";
+                case LogType::Input:
+                    return "Input";
+                case LogType::Output:
+                    return "Output";
+                default:
+                    return "?";
+            }
+        }
+    };
+} // namespace ML
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief  Decodes a binary trace file given as the only argument.
+/// @return process exit code.
+//////////////////////////////////////////////////////////////////////////
+int main(
+    int    argc,
+    char** argv )
+{
+    if( argc != 2 )
+    {
+        std::cerr << "Usage: " << argv[0] << " <trace file>\n";
+        return EXIT_FAILURE;
+    }
+
+    ML::TraceDecoder decoder;
+
+    if( !decoder.Open( argv[1] ) )
+    {
+        return EXIT_FAILURE;
+    }
+
+    decoder.Print();
+
+    return EXIT_SUCCESS;
+}
@@ -31,6 +31,7 @@ namespace ML
         void*                      m_Buffer;
         uint32_t                   m_Size;
         uint32_t                   m_Usage;
+        uint32_t                   m_Reserved; // Space already validated by Reserve().
         const GpuCommandBufferType m_Type;
         const GpuMemory_1_0&       m_GpuMemory;
         TT::Context&               m_Context;
@@ -53,6 +54,7 @@ namespace ML
             : m_Buffer( buffer )
             , m_Size( size )
             , m_Usage( 0 )
+            , m_Reserved( 0 )
             , m_Type( type )
             , m_GpuMemory( memory )
             , m_Context( context )
@@ -83,63 +85,68 @@ namespace ML
         {
             ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
 
-            constexpr uint32_t commandSize = sizeof( command );
-            const bool         validSpace  = m_Usage + commandSize <= m_Size;
-            const bool         validBuffer = m_Buffer && validSpace;
+            uint8_t* target = Allocate( sizeof( command ) );
 
-            if( validBuffer )
+            if( target )
             {
-                T::Tools::MemoryCopy( static_cast<uint8_t*>( m_Buffer ) + m_Usage, m_Size, &command, commandSize );
-
-                m_Usage += commandSize;
+                // Gpu commands are trivially copyable, so the copy is emitted
+                // as fixed size stores directly into the command buffer.
+                new( target ) GpuCommand( command );
             }
 
-            ML_ASSERT( validBuffer );
+            ML_ASSERT( target );
 
-            return log.m_Result = validBuffer
+            return log.m_Result = target
                 ? StatusCode::Success
                 : StatusCode::InsufficientSpace;
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief  Returns pointer to the command buffer.
-        /// @return pointer to the command buffer.
+        /// @brief  Validates space for a sequence of gpu commands once, so
+        ///         the following writes up to the given size are not checked.
+        /// @param  size    gpu commands size.
+        /// @return         operation status.
         //////////////////////////////////////////////////////////////////////////
-        ML_INLINE uint8_t* GetBuffer()
+        ML_INLINE StatusCode Reserve( const uint32_t size )
         {
-            return static_cast<uint8_t*>( m_Buffer );
-        }
+            const bool validBuffer = m_Buffer && m_Usage + size <= m_Size;
 
-    private:
-        //////////////////////////////////////////////////////////////////////////
-        /// @brief  Returns gpu memory address from gpu command.
-        /// @param  command gpu command.
-        /// @return         gpu memory address.
-        //////////////////////////////////////////////////////////////////////////
-        ML_INLINE static uint64_t GetMemoryAddress( const TT::Layouts::GpuCommands::MI_REPORT_PERF_COUNT& command )
-        {
-            return command.GetMemoryAddress();
+            m_Reserved = validBuffer ? size : 0;
+
+            return validBuffer
+                ? StatusCode::Success
+                : StatusCode::InsufficientSpace;
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief  Returns gpu memory address from gpu command.
-        /// @param  command gpu command.
-        /// @return         gpu memory address.
+        /// @brief  Allocates space for gpu commands.
+        /// @param  size    gpu commands size.
+        /// @return         pointer to the allocated space, null if not enough space.
         //////////////////////////////////////////////////////////////////////////
-        ML_INLINE static uint64_t GetMemoryAddress( const TT::Layouts::GpuCommands::MI_STORE_REGISTER_MEM& command )
+        ML_INLINE uint8_t* Allocate( const uint32_t size )
         {
-            return command.GetMemoryAddress();
+            if( size <= m_Reserved )
+            {
+                m_Reserved -= size;
+            }
+            else if( m_Buffer == nullptr || m_Usage + size > m_Size )
+            {
+                return nullptr;
+            }
+
+            uint8_t* target = static_cast<uint8_t*>( m_Buffer ) + m_Usage;
+            m_Usage += size;
+
+            return target;
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief  Returns gpu memory address from gpu command.
-        /// @param  command gpu command.
-        /// @return         gpu memory address.
+        /// @brief  Returns pointer to the command buffer.
+        /// @return pointer to the command buffer.
         //////////////////////////////////////////////////////////////////////////
-        template <typename GpuCommand>
-        ML_INLINE static uint64_t GetMemoryAddress( const GpuCommand& )
+        ML_INLINE uint8_t* GetBuffer()
         {
-            return 0;
+            return static_cast<uint8_t*>( m_Buffer );
         }
     };
 
@@ -207,4 +214,143 @@ namespace ML
             return nullptr;
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief GpuCommandBufferTemplateTrait object.
+    ///        Records gpu commands once against a zero base address and
+    ///        replays them to another command buffer with the memory address
+    ///        fields relocated to a given gpu address.
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct GpuCommandBufferTemplateTrait
+    {
+        ML_DELETE_DEFAULT_CONSTRUCTOR( GpuCommandBufferTemplateTrait );
+        ML_DELETE_DEFAULT_COPY_AND_MOVE( GpuCommandBufferTemplateTrait );
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Types.
+        //////////////////////////////////////////////////////////////////////////
+        using PatchFunction = void ( * )( uint8_t* command, const uint64_t address );
+
+        struct Patch
+        {
+            uint32_t      m_Offset;
+            PatchFunction m_Function;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Members.
+        //////////////////////////////////////////////////////////////////////////
+        std::vector<uint8_t>       m_Commands;
+        std::vector<Patch>         m_Patches;
+        const GpuCommandBufferType m_Type;
+        TT::Context&               m_Context;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief GpuCommandBufferTemplateTrait constructor.
+        /// @param type     internal buffer type.
+        /// @param context  library context.
+        //////////////////////////////////////////////////////////////////////////
+        GpuCommandBufferTemplateTrait(
+            const GpuCommandBufferType type,
+            TT::Context&               context )
+            : m_Commands{}
+            , m_Patches{}
+            , m_Type( type )
+            , m_Context( context )
+        {
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Records gpu command to the template.
+        /// @param  patchMemory flag that indicates that command should be patched.
+        /// @param  command     gpu command to record.
+        /// @return             operation status.
+        //////////////////////////////////////////////////////////////////////////
+        template <bool patchMemory, typename GpuCommand>
+        ML_INLINE StatusCode Write( const GpuCommand& command )
+        {
+            const uint32_t offset = static_cast<uint32_t>( m_Commands.size() );
+            const auto     bytes  = reinterpret_cast<const uint8_t*>( &command );
+
+            m_Commands.insert( m_Commands.end(), bytes, bytes + sizeof( command ) );
+
+            if constexpr( patchMemory )
+            {
+                m_Patches.push_back( { offset, &PatchMemoryAddress<GpuCommand> } );
+            }
+
+            return StatusCode::Success;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Writes recorded gpu commands to command buffer with memory
+        ///         addresses relocated to a given gpu address.
+        /// @param  buffer  target command buffer.
+        /// @param  address gpu memory address.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename CommandBuffer>
+        ML_INLINE StatusCode Emit(
+            CommandBuffer& buffer,
+            const uint64_t address ) const
+        {
+            const uint32_t commandsSize = static_cast<uint32_t>( m_Commands.size() );
+
+            if constexpr( std::is_same<CommandBuffer, TT::GpuCommandBuffer>() )
+            {
+                ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
+                // Gpu commands store dword aligned memory addresses only.
+                ML_ASSERT( ( address % sizeof( uint32_t ) ) == 0 );
+
+                if( commandsSize == 0 )
+                {
+                    return log.m_Result;
+                }
+
+                uint8_t* target = buffer.Allocate( commandsSize );
+
+                if( target )
+                {
+                    T::Tools::MemoryCopy( target, commandsSize, m_Commands.data(), commandsSize );
+
+                    for( const auto& patch : m_Patches )
+                    {
+                        patch.m_Function( target + patch.m_Offset, address );
+                    }
+                }
+
+                ML_ASSERT( target );
+
+                return log.m_Result = target
+                    ? StatusCode::Success
+                    : StatusCode::InsufficientSpace;
+            }
+            else
+            {
+                buffer.m_Usage += commandsSize;
+
+                return StatusCode::Success;
+            }
+        }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Relocates gpu memory address of a recorded gpu command.
+        /// @param  command recorded gpu command bytes.
+        /// @param  address gpu memory address to add.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename GpuCommand>
+        ML_INLINE static void PatchMemoryAddress(
+            uint8_t*       command,
+            const uint64_t address )
+        {
+            GpuCommand patched = {};
+
+            T::Tools::MemoryCopy( &patched, sizeof( patched ), command, sizeof( patched ) );
+            patched.SetMemoryAddress( patched.GetMemoryAddress() + address );
+            T::Tools::MemoryCopy( command, sizeof( patched ), &patched, sizeof( patched ) );
+        }
+    };
 } // namespace ML
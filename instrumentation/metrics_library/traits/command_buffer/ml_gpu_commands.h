@@ -129,6 +129,40 @@ namespace ML::BASE
             return log.m_Result = buffer.template Write<true>( command );
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Writes gpu commands to store a contiguous range of 32 bit
+        ///         registers in a contiguous memory range. Current generations
+        ///         store one dword per MI_STORE_REGISTER_MEM, a generation that
+        ///         supports multi dword register reads may override it.
+        /// @param  buffer          target command buffer.
+        /// @param  registerAddress first register address.
+        /// @param  memoryAddress   first memory address.
+        /// @param  count           registers count.
+        /// @param  flags           gpu command flags.
+        /// @return                 operation status.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename CommandBuffer>
+        ML_INLINE static StatusCode StoreRegistersToMemory32(
+            CommandBuffer& buffer,
+            const uint32_t registerAddress,
+            const uint64_t memoryAddress,
+            const uint32_t count,
+            const Flags    flags = Flags::None )
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &buffer.m_Context );
+
+            for( uint32_t i = 0; i < count; ++i )
+            {
+                ML_FUNCTION_CHECK( T::GpuCommands::StoreRegisterToMemory32(
+                    buffer,
+                    registerAddress + i * sizeof( uint32_t ),
+                    memoryAddress + i * sizeof( uint32_t ),
+                    flags ) );
+            }
+
+            return log.m_Result;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Writes MI_STORE_DATA_IMMEDIATE command to gpu command buffer
         ///         to store a 32 bit constant in memory.
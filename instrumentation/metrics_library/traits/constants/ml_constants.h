@@ -85,7 +85,8 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         struct OaBuffer
         {
-            static constexpr uint32_t m_InvalidOffset = 0xFFFFFFFF;
+            static constexpr uint32_t m_InvalidOffset          = 0xFFFFFFFF;
+            static constexpr uint32_t m_TriggeredReportsProbes = 8; // Max entries checked by a triggered reports lookup.
         };
 
         //////////////////////////////////////////////////////////////////////////
@@ -101,8 +102,10 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         struct Query
         {
-            static constexpr uint32_t m_DummyContextId = 0xFFFFFFFF;
-            static constexpr uint32_t m_QuerySourceId  = 0xC0000000;
+            static constexpr uint32_t m_DummyContextId           = 0xFFFFFFFF;
+            static constexpr uint32_t m_QuerySourceId            = 0xC0000000;
+            static constexpr uint32_t m_MinSlotsPerResolveThread = 1024;
+            static constexpr uint32_t m_AsyncResolveInterval     = 1; // Milliseconds between background resolve passes while ended slots are not ready.
         };
 
         //////////////////////////////////////////////////////////////////////////
@@ -116,6 +119,7 @@ namespace ML
             static constexpr uint32_t    m_IndentSize                = 4;
             static constexpr bool        m_SimplifyFunctionName      = false;
             static constexpr uint32_t    m_SimplifyFunctionNameLevel = 0;
+            static constexpr uint32_t    m_FunctionNamesCount        = 4096; // Interned function names, power of two.
             static constexpr uint32_t    m_MaxFunctionNameLength     = 25;
             static constexpr uint32_t    m_MaxReportReasonLength     = 2;  //                   64.
             static constexpr uint32_t    m_MaxReportIdLength         = 4;  //                 4096.
@@ -132,6 +136,20 @@ namespace ML
             static constexpr bool        m_FlushEachLog              = true;
         };
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Binary trace constants.
+        //////////////////////////////////////////////////////////////////////////
+        struct Trace
+        {
+            static constexpr uint32_t    m_Version                   = 1;
+            static constexpr uint32_t    m_RecordSize                = 64;
+            static constexpr uint32_t    m_RingRecordsCount          = 16384; // Per thread, power of two.
+            static constexpr uint32_t    m_MessageRecordsCount       = 16;    // Max records used by a single log.
+            static constexpr uint32_t    m_MaxValueSize              = 256;   // Larger values are traced as opaque.
+            static constexpr uint32_t    m_FlushInterval             = 10;    // Milliseconds between background flushes.
+            static constexpr const char* m_Magic                     = "MLTRACE";
+        };
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief Library constants.
         //////////////////////////////////////////////////////////////////////////
@@ -147,7 +165,12 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         struct Object
         {
-            static constexpr uint32_t m_MagicHeader = 0xF1E2D3C4;
+            static constexpr uint32_t m_MagicHeader       = 0xF1E2D3C4;
+            static constexpr uint32_t m_TypeGroupSize     = 10000; // Object types are grouped by ten thousands.
+            static constexpr uint32_t m_TypeGroupCount    = static_cast<uint32_t>( ObjectType::Last ) / m_TypeGroupSize + 1;
+            static constexpr uint32_t m_MinBlockShift     = 6;  // Smallest cached object memory block, 64 bytes.
+            static constexpr uint32_t m_MaxBlockShift     = 20; // Largest cached object memory block, 1 megabyte.
+            static constexpr uint32_t m_CachedBlocksCount = 8;  // Released memory blocks kept per block size.
         };
     };
 } // namespace ML
@@ -37,6 +37,9 @@ namespace ML
         bool     m_SubDeviceDataPresent;
         uint32_t m_SubDeviceCount;
         uint32_t m_SubDeviceIndex;
+        uint32_t m_ResolveThreadsCount;
+        bool     m_AsyncResolveEnabled;
+        uint32_t m_AsyncResolveReportsCount;
 
         //////////////////////////////////////////////////////////////////////////
         /// @brief ClientOptionsTrait constructor.
@@ -53,6 +56,9 @@ namespace ML
             , m_SubDeviceDataPresent( false )
             , m_SubDeviceCount( 0 )
             , m_SubDeviceIndex( 0 )
+            , m_ResolveThreadsCount( 1 )
+            , m_AsyncResolveEnabled( false )
+            , m_AsyncResolveReportsCount( 0 )
         {
             ML_FUNCTION_LOG( StatusCode::Success, &context );
 
@@ -105,6 +111,18 @@ namespace ML
                             log.Info( "Workload partition enabled", m_WorkloadPartitionEnabled );
                             break;
 
+                        case ClientOptionsType::ResolveThreads:
+                            m_ResolveThreadsCount = options.ResolveThreads.Count;
+                            log.Info( "Resolve threads count", m_ResolveThreadsCount );
+                            break;
+
+                        case ClientOptionsType::AsyncResolve:
+                            m_AsyncResolveEnabled      = options.AsyncResolve.Enabled;
+                            m_AsyncResolveReportsCount = options.AsyncResolve.ReportsCount;
+                            log.Info( "Async resolve enabled", m_AsyncResolveEnabled );
+                            log.Info( "Async resolve reports count", m_AsyncResolveReportsCount );
+                            break;
+
                         default:
                             log.Warning( "Unknown client option", clientData.ClientOptions[i].Type );
                             break;
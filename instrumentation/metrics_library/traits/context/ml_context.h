@@ -38,18 +38,20 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         /// @brief Members.
         //////////////////////////////////////////////////////////////////////////
-        uint32_t                  m_AdapterId;
-        TT::Debug                 m_Debug;
-        TT::KernelInterface       m_Kernel;
-        TT::OaBuffer              m_OaBuffer;
-        TT::ClientOptions         m_ClientOptions;
-        const ClientHandle_1_0    m_ClientHandle;
-        const ClientCallbacks_1_0 m_ClientCallbacks;
-        ClientData_1_0            m_ClientData;
-        TT::SubDevice             m_SubDevice;
-        TT::DdiObjects            m_DdiObjects;
-        TT::State                 m_State;
-        TT::InternalFeature       m_Internal;
+        uint32_t                        m_AdapterId;
+        TT::Debug                       m_Debug;
+        TT::KernelInterface             m_Kernel;
+        TT::OaBuffer                    m_OaBuffer;
+        TT::ClientOptions               m_ClientOptions;
+        const ClientHandle_1_0          m_ClientHandle;
+        const ClientCallbacks_1_0       m_ClientCallbacks;
+        ClientData_1_0                  m_ClientData;
+        TT::SubDevice                   m_SubDevice;
+        TT::DdiObjects                  m_DdiObjects;
+        TT::State                       m_State;
+        TT::InternalFeature             m_Internal;
+        TT::Queries::HwCountersResolver m_Resolver;
+        TT::ThreadPool                  m_ThreadPool;
 
         //////////////////////////////////////////////////////////////////////////
         /// @brief ContextTrait constructor.
@@ -72,6 +74,8 @@ namespace ML
             , m_DdiObjects( *this )
             , m_State{}
             , m_Internal{}
+            , m_Resolver( *this )
+            , m_ThreadPool( *this )
         {
         }
 
@@ -80,6 +84,10 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         ~ContextTrait()
         {
+            // Stop worker threads and background resolve before releasing oa buffer.
+            m_ThreadPool.Release();
+            m_Resolver.Release();
+
             // Release reference to oa buffer.
             m_OaBuffer.Release();
         }
@@ -138,6 +146,8 @@ namespace ML
             ML_FUNCTION_CHECK( m_Kernel.Initialize( m_ClientData ) );
             ML_FUNCTION_CHECK( m_Kernel.GetAdapterId( m_AdapterId ) );
             ML_FUNCTION_CHECK( m_OaBuffer.Initialize() );
+            ML_FUNCTION_CHECK( m_Resolver.Initialize() );
+            ML_FUNCTION_CHECK( m_ThreadPool.Initialize() );
 
             return log.m_Result;
         }
@@ -18,6 +18,97 @@ SPDX-License-Identifier: MIT
 
 namespace ML
 {
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Interned simplified function names, keyed by function name
+    ///        address. Open addressing table where entries are claimed with
+    ///        a single compare exchange and never removed, so lookups do not
+    ///        take any lock.
+    //////////////////////////////////////////////////////////////////////////
+    struct FunctionNames
+    {
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Table entry.
+        //////////////////////////////////////////////////////////////////////////
+        struct Entry
+        {
+            std::atomic<const char*> m_Key;     // Function name address.
+            std::atomic<const char*> m_Name;    // Published once simplified.
+            std::unique_ptr<char[]>  m_Storage; // Written only by the thread that claimed the key.
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Members.
+        //////////////////////////////////////////////////////////////////////////
+        std::array<Entry, Constants::Log::m_FunctionNamesCount> m_Entries;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief FunctionNames constructor.
+        //////////////////////////////////////////////////////////////////////////
+        FunctionNames()
+            : m_Entries{}
+        {
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns function names table shared by all threads.
+        /// @return function names table.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static FunctionNames& GetInstance()
+        {
+            static FunctionNames functionNames;
+            return functionNames;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns an interned simplified function name. A thread that
+        ///         looks up a name being simplified by another thread gets
+        ///         the original name.
+        /// @param  name        function name.
+        /// @param  simplify    function name simplifying function.
+        /// @return             simplified function name.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename Simplify>
+        ML_INLINE const char* Get(
+            const char* name,
+            Simplify    simplify )
+        {
+            constexpr uint64_t mask  = Constants::Log::m_FunctionNamesCount - 1;
+            uint64_t           index = ( reinterpret_cast<uintptr_t>( name ) * 0x9E3779B97F4A7C15ull ) >> 32;
+
+            for( uint32_t i = 0; i < Constants::Log::m_FunctionNamesCount; ++i, ++index )
+            {
+                Entry&      entry = m_Entries[index & mask];
+                const char* key   = entry.m_Key.load( std::memory_order_acquire );
+
+                if( key == nullptr && entry.m_Key.compare_exchange_strong( key, name, std::memory_order_acq_rel ) )
+                {
+                    const std::string simplified = simplify( name );
+
+                    entry.m_Storage = std::unique_ptr<char[]>( new( std::nothrow ) char[simplified.size() + 1] );
+
+                    if( entry.m_Storage != nullptr )
+                    {
+                        iu_strncpy_s( entry.m_Storage.get(), simplified.size() + 1, simplified.c_str(), simplified.size() );
+                    }
+
+                    const char* interned = entry.m_Storage ? entry.m_Storage.get() : name;
+
+                    entry.m_Name.store( interned, std::memory_order_release );
+                    return interned;
+                }
+
+                if( key == name )
+                {
+                    const char* simplified = entry.m_Name.load( std::memory_order_acquire );
+                    return simplified ? simplified : name;
+                }
+            }
+
+            // Table is full.
+            return name;
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     /// @brief A structure that logs function entered/exiting.
     //////////////////////////////////////////////////////////////////////////
@@ -30,7 +121,7 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         /// @brief Types.
         //////////////////////////////////////////////////////////////////////////
-        std::string  m_Name;
+        const char*  m_Name;    // Points to a literal or to a cached simplified name, no copy is made.
         Result       m_Result;
         TT::Context* m_Context;
 
@@ -44,12 +135,16 @@ namespace ML
             const char*  name,
             const Result result,
             TT::Context* context )
-            : m_Result( result )
+            : m_Name( name )
+            , m_Result( result )
             , m_Context( context )
         {
-            if( T::Tools::CheckLogLayer() )
+            if constexpr( T::ConstantsOs::Log::m_SimplifyFunctionName )
             {
-                SetFunctionName( name );
+                if( T::Tools::CheckLogLayer() )
+                {
+                    SetFunctionName( name );
+                }
             }
 
             if( m_Context != nullptr )
@@ -57,7 +152,7 @@ namespace ML
                 m_Context->m_Debug.IncrementIndentLevel();
             }
 
-            T::Tools::Log( LogType::Entered, m_Name, m_Context, std::string( Constants::Log::m_EnteredFunctionTag ) );
+            T::Tools::Log( LogType::Entered, m_Name, m_Context, Constants::Log::m_EnteredFunctionTag );
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -65,7 +160,7 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         ~FunctionLogTrait()
         {
-            T::Tools::Log( LogType::Exiting, m_Name, m_Context, std::string( Constants::Log::m_ExitingFunctionTag ), m_Result );
+            T::Tools::Log( LogType::Exiting, m_Name, m_Context, Constants::Log::m_ExitingFunctionTag, m_Result );
 
             if( m_Context != nullptr )
             {
@@ -73,36 +168,27 @@ namespace ML
             }
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Replaces function name with its simplified, interned copy.
+        ///         The name is simplified once per call site, next calls only
+        ///         read the interned names table.
+        /// @param  name    full function name (full path, namespace etc.).
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void SetFunctionName( const char* name )
+        {
+            m_Name = FunctionNames::GetInstance().Get( name, &SimplifyFunctionName );
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Strips string of information that is not useful from
         ///         logging perspective (e.g. information has been already logged etc.).
         ///         Right now, namespace and template are both removed.
         /// @param  name    full function name (full path, namespace etc.).
+        /// @return         simplified function name.
         //////////////////////////////////////////////////////////////////////////
-        ML_INLINE void SetFunctionName( const char* name )
+        ML_INLINE static std::string SimplifyFunctionName( const char* name )
         {
-            // Store a function name.
-            m_Name = name;
-
-            // If requested, simplify it.
-            if( !T::ConstantsOs::Log::m_SimplifyFunctionName )
-            {
-                return;
-            }
-
-            auto& functionNamesMap = T::Debug::GetFunctionNamesMap();
-            auto& mutex            = T::Debug::GetMutex();
-
-            std::lock_guard<std::mutex> guard( mutex );
-
-            auto foundFunctionName = functionNamesMap.find( m_Name );
-            if( foundFunctionName != functionNamesMap.end() )
-            {
-                m_Name = foundFunctionName->second;
-                return;
-            }
-
-            std::string erasedString( m_Name );
+            std::string erasedString( name );
 
             // Remove "ML::" namespace from function name.
             const auto& namespaceBegin = erasedString.find_first_of( "M" );
@@ -123,11 +209,7 @@ namespace ML
             // Remove namespaces from function name.
             RemoveNamespaces( Constants::Log::m_SimplifyFunctionNameLevel, erasedString );
 
-            // Cache result.
-            functionNamesMap.insert( { m_Name, erasedString } );
-
-            // Store a simplified function name.
-            m_Name = erasedString;
+            return erasedString;
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -246,13 +328,13 @@ namespace ML
         ////////////////////////////////////////////////////////////////////////
         template <typename... Values>
         ML_INLINE static void ErrorStatic(
-            const std::string& functionName,
-            const StatusCode   result,
+            const char*      functionName,
+            const StatusCode result,
             const Values&... values )
         {
-            T::Tools::Log( LogType::Entered, functionName, nullptr, std::string( Constants::Log::m_EnteredFunctionTag ) );
+            T::Tools::Log( LogType::Entered, functionName, nullptr, Constants::Log::m_EnteredFunctionTag );
             T::Tools::Log( LogType::Error, functionName, nullptr, values... );
-            T::Tools::Log( LogType::Exiting, functionName, nullptr, std::string( Constants::Log::m_ExitingFunctionTag ), result );
+            T::Tools::Log( LogType::Exiting, functionName, nullptr, Constants::Log::m_ExitingFunctionTag, result );
         }
 
         //////////////////////////////////////////////////////////////////////////
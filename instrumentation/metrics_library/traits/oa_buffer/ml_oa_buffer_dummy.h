@@ -29,8 +29,9 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Members.
         //////////////////////////////////////////////////////////////////////////
-        TT::Layouts::HwCounters::ReportOa m_OaReportDummy;
-        TT::Context&                      m_Context;
+        TT::Layouts::HwCounters::ReportOa       m_OaReportDummy;
+        TT::Layouts::OaBuffer::TriggeredReports m_TriggeredReports;
+        TT::Context&                            m_Context;
 
     public:
         //////////////////////////////////////////////////////////////////////////
@@ -39,6 +40,7 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         OaBufferDummyTrait( const TT::KernelInterface& kernel )
             : m_OaReportDummy{}
+            , m_TriggeredReports{}
             , m_Context( kernel.m_Context )
         {
         }
@@ -71,6 +73,24 @@ namespace ML
             return StatusCode::Success;
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Locks oa buffer state shared by query calculations.
+        /// @return lock, not owning a mutex since there is no shared state.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::unique_lock<std::mutex> Lock() const
+        {
+            return std::unique_lock<std::mutex>();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns triggered oa reports index.
+        /// @return empty triggered oa reports index.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE TT::Layouts::OaBuffer::TriggeredReports& GetTriggeredReports()
+        {
+            return m_TriggeredReports;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Checks oa buffer state.
         /// @return true if oa buffer has valid state.
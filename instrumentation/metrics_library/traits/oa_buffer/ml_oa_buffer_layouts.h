@@ -257,6 +257,137 @@ namespace ML
             }
         };
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Triggered oa reports offsets indexed by query id, so lookups
+        ///        for next query slots do not scan the same reports again.
+        ///        Entries are a hint only, oa reports they point to may have
+        ///        been overwritten and need to be validated.
+        //////////////////////////////////////////////////////////////////////////
+        struct TriggeredReports
+        {
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Table entry, query id equal to zero marks an empty entry.
+            //////////////////////////////////////////////////////////////////////////
+            struct Entry
+            {
+                uint32_t m_QueryId;
+                uint32_t m_Offset;
+            };
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Members.
+            //////////////////////////////////////////////////////////////////////////
+            std::vector<Entry> m_Entries;
+            uint32_t           m_Shift;
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief TriggeredReports constructor.
+            //////////////////////////////////////////////////////////////////////////
+            TriggeredReports()
+                : m_Entries{}
+                , m_Shift( 0 )
+            {
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Allocates entries for a given oa buffer reports count.
+            ///        Does nothing if entries have been already allocated.
+            /// @param reportsCount oa buffer reports count.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE void Initialize( const uint32_t reportsCount )
+            {
+                if( !m_Entries.empty() || reportsCount == 0 )
+                {
+                    return;
+                }
+
+                uint32_t bits = 1;
+
+                while( bits < 31 && ( 1u << bits ) < reportsCount )
+                {
+                    ++bits;
+                }
+
+                m_Entries.assign( 1u << bits, Entry{} );
+                m_Shift = 32 - bits;
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Stores triggered oa report offset for a given query id.
+            ///        If all probed entries are taken, the first one is replaced.
+            /// @param queryId  query id.
+            /// @param offset   triggered oa report offset.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE void Insert(
+                const uint32_t queryId,
+                const uint32_t offset )
+            {
+                if( m_Entries.empty() || queryId == 0 )
+                {
+                    return;
+                }
+
+                const uint32_t first = GetIndex( queryId );
+
+                for( uint32_t i = 0; i < Constants::OaBuffer::m_TriggeredReportsProbes; ++i )
+                {
+                    auto& entry = m_Entries[( first + i ) & ( m_Entries.size() - 1 )];
+
+                    if( entry.m_QueryId == queryId || entry.m_QueryId == 0 )
+                    {
+                        entry = { queryId, offset };
+                        return;
+                    }
+                }
+
+                m_Entries[first] = { queryId, offset };
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief  Returns triggered oa report offset for a given query id.
+            /// @param  queryId query id.
+            /// @return         oa report offset, invalid offset if not found.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE uint32_t Find( const uint32_t queryId ) const
+            {
+                if( m_Entries.empty() || queryId == 0 )
+                {
+                    return Constants::OaBuffer::m_InvalidOffset;
+                }
+
+                const uint32_t first = GetIndex( queryId );
+
+                for( uint32_t i = 0; i < Constants::OaBuffer::m_TriggeredReportsProbes; ++i )
+                {
+                    const auto& entry = m_Entries[( first + i ) & ( m_Entries.size() - 1 )];
+
+                    if( entry.m_QueryId == queryId )
+                    {
+                        return entry.m_Offset;
+                    }
+
+                    if( entry.m_QueryId == 0 )
+                    {
+                        break;
+                    }
+                }
+
+                return Constants::OaBuffer::m_InvalidOffset;
+            }
+
+        private:
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief  Returns the first entry index for a given query id.
+            /// @param  queryId query id.
+            /// @return         entry index.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE uint32_t GetIndex( const uint32_t queryId ) const
+            {
+                // Fibonacci hashing spreads consecutive query ids.
+                return ( queryId * 2654435769u ) >> m_Shift;
+            }
+        };
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief Sanity check.
         //////////////////////////////////////////////////////////////////////////
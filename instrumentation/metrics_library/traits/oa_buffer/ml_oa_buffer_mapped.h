@@ -37,10 +37,12 @@ namespace ML::BASE
         //////////////////////////////////////////////////////////////////////////
         /// @brief Members.
         //////////////////////////////////////////////////////////////////////////
-        TT::KernelInterface&              m_Kernel;
-        const TT::Layouts::OaBuffer::Type m_OaBufferType;
-        TT::TbsInterface::OaBufferMapped& m_OaBuffer;
-        TT::Layouts::HwCounters::ReportOa m_ReportSplitted;
+        TT::KernelInterface&                    m_Kernel;
+        const TT::Layouts::OaBuffer::Type       m_OaBufferType;
+        TT::TbsInterface::OaBufferMapped&       m_OaBuffer;
+        TT::Layouts::HwCounters::ReportOa       m_ReportSplitted;
+        TT::Layouts::OaBuffer::TriggeredReports m_TriggeredReports; // Triggered reports found by previous lookups.
+        std::mutex                              m_Mutex;            // Guards state shared by query calculations within the context.
 
     public:
         //////////////////////////////////////////////////////////////////////////
@@ -53,6 +55,8 @@ namespace ML::BASE
             , m_OaBufferType( T::Layouts::OaBuffer::Type::Oa )
             , m_OaBuffer( kernel.m_Tbs.GetOaBufferMapped( m_OaBufferType ) )
             , m_ReportSplitted{}
+            , m_TriggeredReports{}
+            , m_Mutex{}
         {
         }
 
@@ -134,6 +138,32 @@ namespace ML::BASE
                 : m_OaBuffer.Unmap();
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Locks oa buffer state shared by query calculations, such as
+        ///         split report copy and roll back cursor. Should be held by
+        ///         a calculation as long as it uses oa reports.
+        /// @return lock.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::unique_lock<std::mutex> Lock()
+        {
+            return std::unique_lock<std::mutex>( m_Mutex );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns triggered oa reports index, sized for all oa buffer
+        ///         reports. Should be used with the oa buffer lock held.
+        /// @return triggered oa reports index.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE TT::Layouts::OaBuffer::TriggeredReports& GetTriggeredReports()
+        {
+            if( m_OaBuffer.m_ReportSize > 0 )
+            {
+                m_TriggeredReports.Initialize( m_OaBuffer.m_Size / m_OaBuffer.m_ReportSize );
+            }
+
+            return m_TriggeredReports;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Checks oa buffer correctness.
         /// @return true if oa buffer has valid state.
@@ -445,9 +475,41 @@ namespace ML::XE_HPG
         using Base::m_Kernel;
         using Base::m_OaBuffer;
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Roll back cursor shared by all queries within the context,
+        ///        one per command buffer type. Report at m_ContextSwitchOffset
+        ///        is a context switch report and there are no context switch
+        ///        reports for the same command buffer type in
+        ///        (m_ContextSwitchOffset, m_ScannedOffset]. Guarded by the oa
+        ///        buffer lock.
+        //////////////////////////////////////////////////////////////////////////
+        struct RollBackCursor
+        {
+            uint32_t m_ContextSwitchOffset;
+            uint64_t m_ContextSwitchTimestamp;
+            uint32_t m_ScannedOffset;
+            bool     m_Valid;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Members.
+        //////////////////////////////////////////////////////////////////////////
+        std::array<RollBackCursor, static_cast<uint32_t>( GpuCommandBufferType::Last )> m_RollBackCursors;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief OaBufferMappedTrait constructor.
+        /// @param kernel   kernel interface.
+        //////////////////////////////////////////////////////////////////////////
+        OaBufferMappedTrait( TT::KernelInterface& kernel )
+            : Base( kernel )
+            , m_RollBackCursors{}
+        {
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Rolls back report offset to the nearest context switch before
-        ///         query begin report.
+        ///         query begin report. Reports already scanned by previous
+        ///         queries are not scanned again.
         /// @param  calculator  hw counters calculator.
         /// @return offset      report offset to update.
         //////////////////////////////////////////////////////////////////////////
@@ -455,27 +517,43 @@ namespace ML::XE_HPG
             const TT::Queries::HwCountersCalculator& calculator,
             uint32_t&                                offset )
         {
-            const uint32_t oaReportsCount = m_OaBuffer.m_Size / m_OaBuffer.m_ReportSize;
+            const uint32_t  startOffset    = offset;
+            const uint32_t  stopOffset     = GetRollBackStopOffset( calculator, startOffset );
+            const uint32_t  oaReportsCount = m_OaBuffer.m_Size / m_OaBuffer.m_ReportSize;
+            RollBackCursor* cursor         = GetRollBackCursor( calculator );
 
             // Roll back offset to the nearest context switch before query begin report.
             for( uint32_t i = 0; i < oaReportsCount; ++i )
             {
+                // Remaining reports were scanned by previous queries.
+                if( offset == stopOffset )
+                {
+                    offset = cursor->m_ContextSwitchOffset;
+                    break;
+                }
+
                 // If report is a context switch and command buffer type matches with source id, stop rolling back.
                 const auto& report = Base::template GetReport<true>( offset );
 
-                const uint32_t sourceId       = static_cast<uint32_t>( report.m_Header.m_ReportId.m_SourceId );
-                const bool     isRcsContext   = calculator.IsRcsContext( sourceId ) && calculator.m_CommandBufferType == GpuCommandBufferType::Render;
-                const bool     isCcsContext   = calculator.IsCcsContext( sourceId ) && calculator.m_CommandBufferType == GpuCommandBufferType::Compute;
-                const bool     isContextValid = report.m_Header.m_ReportId.m_ContextValid; // Context id is valid only for context switch reports when entering into a context.
-
-                if( ( isRcsContext || isCcsContext ) && isContextValid )
+                if( IsRollBackContextSwitch( calculator, report ) )
                 {
+                    if( cursor )
+                    {
+                        cursor->m_ContextSwitchOffset    = offset;
+                        cursor->m_ContextSwitchTimestamp = report.m_Header.m_Timestamp;
+                        cursor->m_Valid                  = true;
+                    }
                     break;
                 }
 
                 // Roll back offset to the previous report.
                 offset = ( offset + m_OaBuffer.m_Size - m_OaBuffer.m_ReportSize ) % m_OaBuffer.m_Size;
             }
+
+            if( cursor && cursor->m_Valid && offset == cursor->m_ContextSwitchOffset )
+            {
+                cursor->m_ScannedOffset = startOffset;
+            }
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -522,6 +600,83 @@ namespace ML::XE_HPG
 
             return log.m_Result;
         }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Checks whether oa report is a context switch report that
+        ///         stops offset roll back.
+        /// @param  calculator  hw counters calculator.
+        /// @param  report      oa report.
+        /// @return             true if report is a context switch report for
+        ///                     calculator's command buffer type.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE bool IsRollBackContextSwitch(
+            const TT::Queries::HwCountersCalculator& calculator,
+            const TT::Layouts::HwCounters::ReportOa& report ) const
+        {
+            const uint32_t sourceId       = static_cast<uint32_t>( report.m_Header.m_ReportId.m_SourceId );
+            const bool     isRcsContext   = calculator.IsRcsContext( sourceId ) && calculator.m_CommandBufferType == GpuCommandBufferType::Render;
+            const bool     isCcsContext   = calculator.IsCcsContext( sourceId ) && calculator.m_CommandBufferType == GpuCommandBufferType::Compute;
+            const bool     isContextValid = report.m_Header.m_ReportId.m_ContextValid; // Context id is valid only for context switch reports when entering into a context.
+
+            return ( isRcsContext || isCcsContext ) && isContextValid;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns offset where roll back can stop and use the context
+        ///         switch found by previous queries.
+        /// @param  calculator  hw counters calculator.
+        /// @param  offset      roll back start offset.
+        /// @return             stop offset, or invalid offset if the whole oa buffer
+        ///                     needs to be scanned.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE uint32_t GetRollBackStopOffset(
+            const TT::Queries::HwCountersCalculator& calculator,
+            const uint32_t                           offset )
+        {
+            RollBackCursor* cursor = GetRollBackCursor( calculator );
+            const uint32_t  size   = m_OaBuffer.m_Size;
+
+            if( !cursor || !cursor->m_Valid )
+            {
+                return Constants::OaBuffer::m_InvalidOffset;
+            }
+
+            // Offset must not be older than the last scanned offset.
+            const uint32_t scannedDistance = ( cursor->m_ScannedOffset + size - cursor->m_ContextSwitchOffset ) % size;
+            const uint32_t offsetDistance  = ( offset + size - cursor->m_ContextSwitchOffset ) % size;
+
+            if( offsetDistance < scannedDistance )
+            {
+                return Constants::OaBuffer::m_InvalidOffset;
+            }
+
+            // Context switch report must not be overwritten. Reports between context switch
+            // and scanned offset are overwritten later than context switch report itself.
+            const auto& report = Base::template GetReport<false>( cursor->m_ContextSwitchOffset );
+
+            if( !IsRollBackContextSwitch( calculator, report ) || static_cast<uint64_t>( report.m_Header.m_Timestamp ) != cursor->m_ContextSwitchTimestamp )
+            {
+                cursor->m_Valid = false;
+                return Constants::OaBuffer::m_InvalidOffset;
+            }
+
+            return cursor->m_ScannedOffset;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns roll back cursor for calculator's command buffer type.
+        /// @param  calculator  hw counters calculator.
+        /// @return             roll back cursor, null if command buffer type is unknown.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE RollBackCursor* GetRollBackCursor( const TT::Queries::HwCountersCalculator& calculator )
+        {
+            const uint32_t type = static_cast<uint32_t>( calculator.m_CommandBufferType );
+
+            return ( type < m_RollBackCursors.size() )
+                ? &m_RollBackCursors[type]
+                : nullptr;
+        }
     };
 } // namespace ML::XE_HPG
 
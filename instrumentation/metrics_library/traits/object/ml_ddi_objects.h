@@ -9,7 +9,7 @@ SPDX-License-Identifier: MIT
 /*
 @file ml_ddi_objects.h
 
-@brief Stores created ddi objects.
+@brief Counts created ddi objects and caches their memory blocks.
        Warns if there are remaining ddi objects on context deletion.
 */
 
@@ -26,12 +26,20 @@ namespace ML
         ML_DELETE_DEFAULT_CONSTRUCTOR( DdiObjectsTrait );
         ML_DELETE_DEFAULT_COPY_AND_MOVE( DdiObjectsTrait );
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Types.
+        //////////////////////////////////////////////////////////////////////////
+        using Counters = std::array<std::atomic<uint32_t>, Constants::Object::m_TypeGroupCount>;
+        using Blocks   = std::array<std::atomic<void*>, Constants::Object::m_CachedBlocksCount>;
+        using Cache    = std::array<Blocks, Constants::Object::m_MaxBlockShift - Constants::Object::m_MinBlockShift + 1>;
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief Members.
         //////////////////////////////////////////////////////////////////////////
-        TT::Context&                    m_Context;
-        std::unordered_set<BaseObject*> m_Objects;
-        std::mutex                      m_Mutex;
+        TT::Context&          m_Context;
+        Counters              m_Objects;    // Live objects count per object type group.
+        Cache                 m_Cache;      // Released memory blocks per power of two block size.
+        std::atomic<uint64_t> m_Generation; // Last generation assigned to a created object.
 
         //////////////////////////////////////////////////////////////////////////
         /// @brief DdiObjectsTrait constructor.
@@ -40,6 +48,8 @@ namespace ML
         DdiObjectsTrait( TT::Context& context )
             : m_Context( context )
             , m_Objects{}
+            , m_Cache{}
+            , m_Generation( 0 )
         {
         }
 
@@ -49,28 +59,102 @@ namespace ML
         ~DdiObjectsTrait()
         {
             ValidateState();
+
+            for( auto& blocks : m_Cache )
+            {
+                for( auto& block : blocks )
+                {
+                    operator delete( block.exchange( nullptr ) );
+                }
+            }
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief Adds ddi object to unordered set.
+        /// @brief Counts a created ddi object.
         /// @param object an object to be added.
         //////////////////////////////////////////////////////////////////////////
         ML_INLINE void AddObject( BaseObject* object )
         {
-            std::lock_guard<std::mutex> guard( m_Mutex );
-
-            m_Objects.insert( object );
+            GetCounter( *object ).fetch_add( 1, std::memory_order_relaxed );
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief Removes ddi object from unordered set.
+        /// @brief Uncounts a deleted ddi object.
         /// @param object an object to be removed.
         //////////////////////////////////////////////////////////////////////////
         ML_INLINE void RemoveObject( BaseObject* object )
         {
-            std::lock_guard<std::mutex> guard( m_Mutex );
+            GetCounter( *object ).fetch_sub( 1, std::memory_order_relaxed );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns a generation for a created ddi object. Cached memory
+        ///         blocks are reused, so an object pointer alone does not tell
+        ///         a deleted object from a new one created in its memory.
+        /// @return object generation, never zero.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE uint64_t GetGeneration()
+        {
+            return m_Generation.fetch_add( 1, std::memory_order_relaxed ) + 1;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns memory for a ddi object. Reuses a memory block
+        ///         released by a previously deleted object if possible.
+        /// @param  size    object size.
+        /// @return         object memory, nullptr if out of memory.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void* AllocateMemory( const size_t size )
+        {
+            const uint32_t index = GetCacheIndex( size );
+
+            if( index >= m_Cache.size() )
+            {
+                return operator new( size, std::nothrow );
+            }
+
+            for( auto& block : m_Cache[index] )
+            {
+                void* memory = block.load( std::memory_order_relaxed )
+                    ? block.exchange( nullptr, std::memory_order_acquire )
+                    : nullptr;
+
+                if( memory )
+                {
+                    return memory;
+                }
+            }
+
+            return operator new( GetBlockSize( index ), std::nothrow );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Releases memory of a deleted ddi object. The memory block is
+        ///        kept for reuse if there is a free cache entry for its size.
+        /// @param memory   object memory.
+        /// @param size     object size.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void ReleaseMemory(
+            void*        memory,
+            const size_t size )
+        {
+            const uint32_t index = GetCacheIndex( size );
 
-            m_Objects.erase( object );
+            if( index < m_Cache.size() )
+            {
+                for( auto& block : m_Cache[index] )
+                {
+                    void* expected = nullptr;
+
+                    if( block.load( std::memory_order_relaxed ) == nullptr &&
+                        block.compare_exchange_strong( expected, memory, std::memory_order_release, std::memory_order_relaxed ) )
+                    {
+                        return;
+                    }
+                }
+            }
+
+            operator delete( memory );
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -80,10 +164,60 @@ namespace ML
         {
             ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
 
-            if( !m_Objects.empty() )
+            for( uint32_t i = 0; i < m_Objects.size(); ++i )
+            {
+                const uint32_t count = m_Objects[i].load( std::memory_order_relaxed );
+
+                if( count > 0 )
+                {
+                    log.Info( "Some ddi objects should be deleted, type group, count", static_cast<ObjectType>( i * Constants::Object::m_TypeGroupSize ), count );
+                }
+            }
+        }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns cache index for a given object size.
+        /// @param  size    object size.
+        /// @return         cache index, out of cache range for large objects.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static uint32_t GetCacheIndex( const size_t size )
+        {
+            uint32_t shift = 0;
+
+            // Bits needed to store size - 1, so the block is the smallest power of two fitting the object.
+            for( size_t bits = size - 1; bits != 0; bits >>= 1 )
             {
-                log.Info( "Some ddi objects should be deleted, count", m_Objects.size() );
+                ++shift;
             }
+
+            return ( shift > Constants::Object::m_MinBlockShift )
+                ? shift - Constants::Object::m_MinBlockShift
+                : 0;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns memory block size for a given cache index.
+        /// @param  index   cache index.
+        /// @return         memory block size.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static size_t GetBlockSize( const uint32_t index )
+        {
+            return size_t{ 1 } << ( index + Constants::Object::m_MinBlockShift );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns live objects counter for a given object type.
+        /// @param  object  ddi object.
+        /// @return         live objects counter.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::atomic<uint32_t>& GetCounter( const BaseObject& object )
+        {
+            const uint32_t group = static_cast<uint32_t>( object.m_ObjectType ) / Constants::Object::m_TypeGroupSize;
+
+            ML_ASSERT_NO_ADAPTER( group < m_Objects.size() );
+
+            return m_Objects[group];
         }
     };
 } // namespace ML
@@ -161,7 +161,8 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         /// @brief Members.
         //////////////////////////////////////////////////////////////////////////
-        TT::Context& m_Context;
+        TT::Context&   m_Context;
+        const uint64_t m_Generation; // Distinguishes objects created in the same reused memory.
 
         //////////////////////////////////////////////////////////////////////////
         /// @brief Ddi object constructor.
@@ -173,6 +174,7 @@ namespace ML
             TT::Context&          context )
             : BaseObject( Type, clientType )
             , m_Context( context )
+            , m_Generation( 0 )
         {
         }
 
@@ -183,6 +185,7 @@ namespace ML
         DdiObject( TT::Context& context )
             : BaseObject( Type, context.m_ClientType )
             , m_Context( context )
+            , m_Generation( ( Type != ObjectType::Context ) ? context.m_DdiObjects.GetGeneration() : 0 )
         {
             if( m_ObjectType != ObjectType::Context )
             {
@@ -202,18 +205,34 @@ namespace ML
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief  Allocates and constructs object instance.
+        /// @brief  Allocates and constructs context instance.
         /// @param  arguments   constructor arguments.
-        /// @return             new object instance.
+        /// @return             new context instance.
         //////////////////////////////////////////////////////////////////////////
         template <typename... Arguments>
         ML_INLINE static Object* Allocate( Arguments&&... arguments )
         {
+            static_assert( Type == ObjectType::Context, "Ddi objects other than context are allocated from context memory" );
+
             Object* object = new( std::nothrow ) Object( std::forward<Arguments>( arguments )... );
             ML_ASSERT_NO_ADAPTER( object );
             return object;
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Allocates object instance from memory cached by a context
+        ///         and constructs it.
+        /// @param  context a reference to context object.
+        /// @return         new object instance.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static Object* Allocate( TT::Context& context )
+        {
+            void*   memory = context.m_DdiObjects.AllocateMemory( sizeof( Object ) );
+            Object* object = memory ? new( memory ) Object( context ) : nullptr;
+            ML_ASSERT_NO_ADAPTER( object );
+            return object;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief Destroys object instance.
         /// @param object   object to delete.
@@ -221,7 +240,19 @@ namespace ML
         ML_INLINE static void Delete( Object*& object )
         {
             ML_ASSERT_NO_ADAPTER( object );
-            delete object;
+
+            if constexpr( Type == ObjectType::Context )
+            {
+                delete object;
+            }
+            else if( object )
+            {
+                auto& ddiObjects = object->m_Context.m_DdiObjects;
+
+                object->~Object();
+                ddiObjects.ReleaseMemory( object, sizeof( Object ) );
+            }
+
             object = nullptr;
         }
 
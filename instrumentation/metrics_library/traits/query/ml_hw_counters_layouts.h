@@ -151,6 +151,8 @@ namespace ML::BASE
             //////////////////////////////////////////////////////////////////////////
             union ReportApiFlags
             {
+                uint32_t    m_Value;
+
                 struct
                 {
                     uint32_t    m_ReportLost                : ML_BITFIELD_BIT( 0 );
@@ -197,6 +199,22 @@ namespace ML::BASE
                 ReportApiFlags                         m_Flags;                         // Report flags are defined in ReportApiFlags.
             };
 
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Compact api report format. The header is followed by values
+            ///        of counters selected with a client counters mask.
+            //////////////////////////////////////////////////////////////////////////
+            struct ReportApiCompact
+            {
+                uint64_t          m_TotalTime;         // Total query time in nanoseconds.
+                uint64_t          m_GpuTicks;
+                uint64_t          m_BeginTimestamp;
+                uint64_t          m_CoreFrequency;     // Core frequency during the query.
+                uint32_t          m_ReportId;
+                uint32_t          m_ReportsCount;
+                ReportApiFlags    m_Flags;             // Report flags are defined in ReportApiFlags.
+                uint32_t          m_CountersCount;     // Counters values count following the header.
+            };
+
             //////////////////////////////////////////////////////////////////////////
             /// @brief Oa report collecting mode.
             //////////////////////////////////////////////////////////////////////////
@@ -37,6 +37,17 @@ namespace ML::BASE
         using Base::DerivedConst;
         using Base::m_Context;
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Begin/end commands cache variants, one per report collecting
+        ///        mode and command buffer type.
+        //////////////////////////////////////////////////////////////////////////
+        static constexpr uint32_t m_CollectingModesCount  = static_cast<uint32_t>( T::Layouts::HwCounters::Query::ReportCollectingMode::TriggerOagExtended ) + 1;
+        static constexpr uint32_t m_BufferTypesCount      = static_cast<uint32_t>( GpuCommandBufferType::Last );
+        static constexpr uint32_t m_CommandsVariantsCount = m_CollectingModesCount * m_BufferTypesCount;
+
+        using CountersTemplates = std::array<std::unique_ptr<TT::GpuCommandBufferTemplate>, m_CommandsVariantsCount * 2>;
+        using CommandsSizes     = std::array<uint32_t, m_CommandsVariantsCount * 8>;
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief Members.
         //////////////////////////////////////////////////////////////////////////
@@ -44,6 +55,13 @@ namespace ML::BASE
         ConfigurationHandle_1_0                     m_UserConfiguration;
         std::vector<TT::Queries::HwCountersSlot>    m_Slots;
         bool                                        m_IsUserConfigurationCopied;
+        bool                                        m_StatusArray;                // End tags are stored in one array after all slot reports.
+        CountersTemplates                           m_CountersTemplates;          // Precompiled begin/end counters commands.
+        CommandsSizes                               m_CommandsSizes;              // Begin/end commands sizes per markers presence, zero if unknown.
+        ConfigurationHandle_1_0                     m_CommandsCacheConfiguration; // User configuration the cache was built for.
+        uint64_t                                    m_CommandsCacheGeneration;    // User configuration generation, its memory can be reused.
+        uint32_t                                    m_CommandsCacheUserRegisters; // User registers id the cache was built for.
+        std::mutex                                  m_Mutex;                      // Guards slots against background resolve.
 
         //////////////////////////////////////////////////////////////////////////
         /// @brief QueryHwCountersTrait constructor.
@@ -55,6 +73,13 @@ namespace ML::BASE
             , m_UserConfiguration{ nullptr }
             , m_Slots{}
             , m_IsUserConfigurationCopied( false )
+            , m_StatusArray( false )
+            , m_CountersTemplates{}
+            , m_CommandsSizes{}
+            , m_CommandsCacheConfiguration{ nullptr }
+            , m_CommandsCacheGeneration( 0 )
+            , m_CommandsCacheUserRegisters( 0 )
+            , m_Mutex{}
         {
         }
 
@@ -65,6 +90,8 @@ namespace ML::BASE
         {
             ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
 
+            m_Context.m_Resolver.Unregister( Derived() );
+
             if constexpr( T::Policy::QueryHwCounters::Create::m_UserCounters )
             {
                 log.m_Result = !m_IsUserConfigurationCopied && m_UserConfiguration.IsValid()
@@ -87,11 +114,18 @@ namespace ML::BASE
         {
             auto& context = T::Context::FromHandle( createData.HandleContext );
             auto  query   = Allocate( context );
-            auto  result  = query ? query->Initialize( createData.Slots ) : StatusCode::OutOfMemory;
+
+            if( query )
+            {
+                query->m_StatusArray = createData.Type == ObjectType::QueryHwCountersStatusArray;
+            }
+
+            auto result = query ? query->Initialize( createData.Slots ) : StatusCode::OutOfMemory;
 
             if( ML_SUCCESS( result ) )
             {
                 handle = query->GetHandle();
+                context.m_Resolver.Register( *query );
             }
             else
             {
@@ -120,9 +154,34 @@ namespace ML::BASE
 
             auto& query = FromHandle( data.Handle );
 
-            return log.m_Result = data.Begin
-                ? query.WriteBegin( buffer, data, gpuMemory )
-                : query.WriteEnd( buffer, data );
+            // Slot states and cached command sizes cannot change during background resolve.
+            const auto guard = query.Lock();
+
+            if constexpr( std::is_same<CommandBuffer, TT::GpuCommandBufferCalculator>() )
+            {
+                return log.m_Result = query.CalculateSize( buffer, data, gpuMemory );
+            }
+            else
+            {
+                // Validate command buffer space once for all begin/end commands if their
+                // size is already known. Otherwise each command validates its own space.
+                uint32_t size = 0;
+
+                ML_FUNCTION_CHECK( query.GetCommandsSize( buffer.m_Type, data, size ) );
+                ML_FUNCTION_CHECK( buffer.Reserve( size ) );
+            }
+
+            ML_FUNCTION_CHECK( query.WriteCommands( buffer, data, gpuMemory ) );
+
+            if( data.Begin )
+            {
+                return log.m_Result;
+            }
+
+            // Ended slot can be resolved in background once gpu completes it.
+            query.m_Context.m_Resolver.Notify();
+
+            return log.m_Result;
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -145,6 +204,9 @@ namespace ML::BASE
             auto& querySource = FromHandle( data.HandleSource );
             auto& queryTarget = FromHandle( data.HandleTarget );
 
+            // Slot states cannot change during background resolve.
+            const auto guard = Lock( querySource, queryTarget );
+
             // Validate requested slot ranges.
             ML_FUNCTION_CHECK( data.SlotSource + data.SlotCount <= querySource.m_Slots.size() );
             ML_FUNCTION_CHECK( data.SlotTarget + data.SlotCount <= queryTarget.m_Slots.size() );
@@ -214,24 +276,395 @@ namespace ML::BASE
             auto& query = FromHandle( getData.Handle );
             ML_FUNCTION_LOG( StatusCode::Success, &query.m_Context );
 
-            auto& kernel     = query.m_Context.m_Kernel;
-            auto  reportsApi = static_cast<TT::Layouts::HwCounters::Query::ReportApi*>( getData.Data );
+            // Slot states cannot change during background resolve.
+            const auto guard = query.Lock();
+
+            ML_FUNCTION_CHECK( static_cast<uint64_t>( getData.Slot ) + getData.SlotsCount <= query.m_Slots.size() );
+
+            auto reportsApi = static_cast<TT::Layouts::HwCounters::Query::ReportApi*>( getData.Data );
+
+            // Check if a configuration was activated before executing query commands.
+            ML_FUNCTION_CHECK( query.ValidateConfigurationActivation() );
+
+            // Slot independent state is computed once for all api reports.
+            const auto     batchState   = T::Queries::HwCountersCalculator::GetBatchState( query );
+            const uint32_t threadsCount = query.GetResolveThreadsCount( getData );
+
+            // Calculate api reports on multiple threads.
+            if( threadsCount > 1 )
+            {
+                return log.m_Result = query.GetDataParallel( getData, batchState, threadsCount );
+            }
+
+            // Calculate all api reports.
+            return log.m_Result = query.CalculateReports(
+                       getData.Slot,
+                       getData.SlotsCount,
+                       batchState,
+                       [&]( const uint32_t i ) -> TT::Layouts::HwCounters::Query::ReportApi& { return reportsApi[i]; },
+                       []( [[maybe_unused]] const uint32_t i ) {} );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns all multisampled query reports of a single slot
+        ///         within one call. If output data is too small, next call
+        ///         continues from the first report not returned yet.
+        /// @return getData data requested by client.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static StatusCode GetDataMultisampled( GetReportQueryMultisampled_1_0& getData )
+        {
+            ML_FUNCTION_CHECK_STATIC( getData.Data != nullptr );
+            ML_FUNCTION_CHECK_STATIC( getData.DataSize >= sizeof( TT::Layouts::HwCounters::Query::ReportApi ) );
+            ML_FUNCTION_CHECK_STATIC( getData.DataSize % sizeof( TT::Layouts::HwCounters::Query::ReportApi ) == 0 );
+            ML_FUNCTION_CHECK_STATIC( IsValid( getData.Handle ) );
+
+            auto& query = FromHandle( getData.Handle );
+            ML_FUNCTION_LOG( StatusCode::Success, &query.m_Context );
+
+            // Slot states cannot change during background resolve.
+            const auto guard = query.Lock();
+
+            ML_FUNCTION_CHECK( getData.Slot < query.m_Slots.size() );
+
+            auto           reportsApi      = static_cast<TT::Layouts::HwCounters::Query::ReportApi*>( getData.Data );
+            const uint32_t reportsCapacity = getData.DataSize / sizeof( TT::Layouts::HwCounters::Query::ReportApi );
+
+            getData.ReportsCount = 0;
+            getData.Completed    = false;
+
+            // Check if a configuration was activated before executing query commands.
+            ML_FUNCTION_CHECK( query.ValidateConfigurationActivation() );
+
+            // Initialize calculator.
+            const auto                        batchState = T::Queries::HwCountersCalculator::GetBatchState( query );
+            TT::Queries::HwCountersCalculator calculator = { batchState, getData.Slot, query, reportsApi[0] };
+
+            // Validate query calls sequence correctness.
+            if( ML_FAIL( calculator.m_QuerySlot.CheckStateConsistency( T::Queries::HwCountersSlot::State::Resolved ) ) )
+            {
+                return log.m_Result = StatusCode::Success;
+            }
+
+            // Calculate all query subsamples.
+            log.m_Result = calculator.GetReportsApiMultisampled( reportsApi, reportsCapacity, getData.ReportsCount, getData.Completed );
+
+            if( ML_FAIL( log.m_Result ) )
+            {
+                log.Warning( "Unable to obtain query api reports for slot index", getData.Slot, log.m_Result );
+            }
+
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns query reports in compact format. Only counters
+        ///         selected in the client counters mask are written after
+        ///         a report header.
+        /// @return getData data requested by client.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static StatusCode GetDataCompact( GetReportQueryCompact_1_0& getData )
+        {
+            ML_FUNCTION_CHECK_STATIC( getData.Data != nullptr );
+            ML_FUNCTION_CHECK_STATIC( getData.CountersMask != nullptr || getData.CountersMaskCount == 0 );
+            ML_FUNCTION_CHECK_STATIC( IsValid( getData.Handle ) );
+
+            auto& query = FromHandle( getData.Handle );
+            ML_FUNCTION_LOG( StatusCode::Success, &query.m_Context );
+
+            // Slot states cannot change during background resolve.
+            const auto guard = query.Lock();
+
+            ML_FUNCTION_CHECK( static_cast<uint64_t>( getData.Slot ) + getData.SlotsCount <= query.m_Slots.size() );
+
+            // Offsets of selected counters within api report.
+            std::vector<uint32_t> countersOffsets = {};
+            countersOffsets.reserve( GetCompactCountersCount() );
+
+            for( uint64_t i = 0; i < getData.CountersMaskCount * 64ull; ++i )
+            {
+                if( getData.CountersMask[i / 64] & ML_BIT( i % 64 ) )
+                {
+                    ML_FUNCTION_CHECK( i < GetCompactCountersCount() );
+                    countersOffsets.push_back( GetCompactCounterOffset( static_cast<uint32_t>( i ) ) );
+                }
+            }
+
+            const uint32_t reportSize = sizeof( TT::Layouts::HwCounters::Query::ReportApiCompact ) + static_cast<uint32_t>( countersOffsets.size() ) * sizeof( uint64_t );
+            ML_FUNCTION_CHECK( getData.DataSize >= static_cast<uint64_t>( getData.SlotsCount ) * reportSize );
+
+            // Check if a configuration was activated before executing query commands.
+            ML_FUNCTION_CHECK( query.ValidateConfigurationActivation() );
+
+            // Api reports are calculated into a single intermediate report
+            // and only selected counters are stored in client memory.
+            const auto                                batchState = T::Queries::HwCountersCalculator::GetBatchState( query );
+            TT::Layouts::HwCounters::Query::ReportApi reportApi  = {};
+            auto                                      data       = static_cast<uint8_t*>( getData.Data );
+
+            return log.m_Result = query.CalculateReports(
+                       getData.Slot,
+                       getData.SlotsCount,
+                       batchState,
+                       [&]( [[maybe_unused]] const uint32_t i ) -> TT::Layouts::HwCounters::Query::ReportApi& { return reportApi; },
+                       [&]( const uint32_t i ) { StoreReportApiCompact( reportApi, countersOffsets, data + i * reportSize ); } );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns query reports in structure of arrays format.
+        ///         Each requested counter is written to its own column.
+        /// @return getData data requested by client.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static StatusCode GetDataColumns( GetReportQueryColumns_1_0& getData )
+        {
+            ML_FUNCTION_CHECK_STATIC( getData.Columns != nullptr || getData.ColumnsCount == 0 );
+            ML_FUNCTION_CHECK_STATIC( getData.ColumnsCount <= GetCompactCountersCount() );
+            ML_FUNCTION_CHECK_STATIC( IsValid( getData.Handle ) );
+
+            auto& query = FromHandle( getData.Handle );
+            ML_FUNCTION_LOG( StatusCode::Success, &query.m_Context );
+
+            // Slot states cannot change during background resolve.
+            const auto guard = query.Lock();
+
+            ML_FUNCTION_CHECK( static_cast<uint64_t>( getData.Slot ) + getData.SlotsCount <= query.m_Slots.size() );
+
+            // Offsets of requested counters within api report with their columns.
+            std::vector<std::pair<uint32_t, uint64_t*>> columns = {};
+            columns.reserve( getData.ColumnsCount );
+
+            for( uint32_t i = 0; i < getData.ColumnsCount; ++i )
+            {
+                if( getData.Columns[i] != nullptr )
+                {
+                    columns.emplace_back( GetCompactCounterOffset( i ), getData.Columns[i] );
+                }
+            }
 
             // Check if a configuration was activated before executing query commands.
+            ML_FUNCTION_CHECK( query.ValidateConfigurationActivation() );
+
+            // Api reports are calculated into a single intermediate report
+            // and requested counters are scattered to client columns.
+            const auto                                batchState = T::Queries::HwCountersCalculator::GetBatchState( query );
+            TT::Layouts::HwCounters::Query::ReportApi reportApi  = {};
+
+            return log.m_Result = query.CalculateReports(
+                       getData.Slot,
+                       getData.SlotsCount,
+                       batchState,
+                       [&]( [[maybe_unused]] const uint32_t i ) -> TT::Layouts::HwCounters::Query::ReportApi& { return reportApi; },
+                       [&]( const uint32_t i ) { StoreReportApiColumns( reportApi, columns, getData, i ); } );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns a bitmap of slots whose gpu reports are ready,
+        ///         so only those slots need to be resolved by the client.
+        ///         Readiness is based on end tags only which are written
+        ///         by gpu after all other report data.
+        /// @return getData data requested by client.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static StatusCode GetDataReadiness( GetReportQueryReadiness_1_0& getData )
+        {
+            ML_FUNCTION_CHECK_STATIC( getData.Bitmap != nullptr );
+            ML_FUNCTION_CHECK_STATIC( getData.BitmapCount * 64ull >= getData.SlotsCount );
+            ML_FUNCTION_CHECK_STATIC( IsValid( getData.Handle ) );
+
+            auto& query = FromHandle( getData.Handle );
+            ML_FUNCTION_LOG( StatusCode::Success, &query.m_Context );
+
+            // Slot states cannot change during background resolve.
+            const auto guard = query.Lock();
+
+            ML_FUNCTION_CHECK( static_cast<uint64_t>( getData.Slot ) + getData.SlotsCount <= query.m_Slots.size() );
+
+            std::fill_n( getData.Bitmap, getData.BitmapCount, 0ull );
+            getData.ReadyCount = 0;
+
+            for( uint32_t i = 0; i < getData.SlotsCount; ++i )
+            {
+                if( query.m_Slots[getData.Slot + i].IsEndTagReady() )
+                {
+                    getData.Bitmap[i / 64] |= ML_BIT( i % 64 );
+                    ++getData.ReadyCount;
+                }
+            }
+
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns counters count that can be selected for compact
+        ///         api reports. Counters are indexed in api report order,
+        ///         hw counters first, then user counters.
+        /// @return counters count.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static constexpr uint32_t GetCompactCountersCount()
+        {
+            using ReportApi = TT::Layouts::HwCounters::Query::ReportApi;
+
+            constexpr uint32_t hwCountersCount   = ( offsetof( ReportApi, m_BeginTimestamp ) - offsetof( ReportApi, m_GpuTicks ) ) / sizeof( uint64_t ) - 1;
+            constexpr uint32_t userCountersCount = ( offsetof( ReportApi, m_UserCounterConfigurationId ) - offsetof( ReportApi, m_UserCounter ) ) / sizeof( uint64_t );
+
+            return hwCountersCount + userCountersCount;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns threads count used to calculate query reports.
+        ///         Only slots that do not use oa buffer are independent
+        ///         and can be calculated in parallel.
+        /// @param  getData data requested by client, with a validated slots range.
+        /// @return         threads count, one if reports should be calculated serially.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE uint32_t GetResolveThreadsCount( const GetReportQuery_1_0& getData ) const
+        {
+            const uint32_t maxCount     = getData.SlotsCount / Constants::Query::m_MinSlotsPerResolveThread;
+            const uint32_t threadsCount = std::min( m_Context.m_ThreadPool.GetThreadsCount(), maxCount );
+
+            if( threadsCount <= 1 )
+            {
+                return 1;
+            }
+
+            for( uint32_t i = 0; i < getData.SlotsCount; ++i )
+            {
+                if( T::Queries::HwCountersCalculator::UseOaBuffer( m_Slots[getData.Slot + i] ) )
+                {
+                    return 1;
+                }
+            }
+
+            return threadsCount;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Calculates query reports on context worker threads. Each
+        ///         thread handles contiguous ranges of slots, calculation
+        ///         results are processed in slot order the same way as in
+        ///         serial path.
+        /// @param  getData         data requested by client.
+        /// @param  batchState      slot independent calculation state.
+        /// @param  threadsCount    threads count.
+        /// @return                 operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode GetDataParallel(
+            GetReportQuery_1_0&                                  getData,
+            const TT::Queries::HwCountersCalculator::BatchState& batchState,
+            const uint32_t                                       threadsCount )
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
+            auto     reportsApi = static_cast<TT::Layouts::HwCounters::Query::ReportApi*>( getData.Data );
+            uint32_t slotsCount = 0;
+
+            // Validate query calls sequence correctness.
+            while( slotsCount < getData.SlotsCount && ML_SUCCESS( m_Slots[getData.Slot + slotsCount].CheckStateConsistency( T::Queries::HwCountersSlot::State::Resolved ) ) )
+            {
+                ++slotsCount;
+            }
+
+            // Calculate query reports.
+            std::vector<StatusCode> results;
+            const uint32_t          slotsPerThread = ( slotsCount + threadsCount - 1 ) / threadsCount;
+
+            auto calculate = [&]( const uint32_t range )
+            {
+                const uint32_t first = range * slotsPerThread;
+                const uint32_t last  = std::min( first + slotsPerThread, slotsCount );
+
+                for( uint32_t i = first; i < last; ++i )
+                {
+                    TT::Queries::HwCountersCalculator calculator = { batchState, getData.Slot + i, Derived(), reportsApi[i] };
+
+                    results[i] = calculator.GetReportApi();
+                }
+            };
+
+            // Exceptions cannot leave the library.
+            try
+            {
+                results.resize( slotsCount, StatusCode::Success );
+
+                ML_FUNCTION_CHECK( m_Context.m_ThreadPool.Execute( threadsCount, calculate ) );
+            }
+            catch( const std::bad_alloc& )
+            {
+                return log.m_Result = StatusCode::OutOfMemory;
+            }
+            catch( ... )
+            {
+                return log.m_Result = StatusCode::Failed;
+            }
+
+            // Process calculation statuses.
+            for( uint32_t i = 0; i < slotsCount; ++i )
+            {
+                if( ML_FAIL( results[i] ) )
+                {
+                    log.Warning( "Unable to obtain query api report for slot index", i, results[i] );
+                }
+
+                log.m_Result = ProcessCalculationResult( log.m_Result, results[i] );
+
+                if( log.m_Result == StatusCode::Failed )
+                {
+                    return log.m_Result;
+                }
+            }
+
+            // Serial path stops at the first inconsistent slot and returns success.
+            return log.m_Result = ( slotsCount < getData.SlotsCount )
+                ? StatusCode::Success
+                : log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Checks if a configuration was activated before executing
+        ///         query commands.
+        /// @return operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode ValidateConfigurationActivation() const
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
             if constexpr( T::Policy::QueryHwCounters::GetData::m_CheckConfigurationActivation )
             {
-                if( kernel.m_ConfigurationManager.m_OaConfigurationReferenceCounter <= 0 )
+                if( m_Context.m_Kernel.m_ConfigurationManager.m_OaConfigurationReferenceCounter <= 0 )
                 {
                     log.Error( "Empty configuration found" );
-                    return log.m_Result = StatusCode::ReportWithEmptyConfiguration;
+                    log.m_Result = StatusCode::ReportWithEmptyConfiguration;
                 }
             }
 
-            // Calculate all api reports.
-            for( uint32_t i = 0; i < getData.SlotsCount; ++i )
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Calculates api reports for consecutive query slots.
+        /// @param  slot            first slot index.
+        /// @param  slotsCount      slots count.
+        /// @param  batchState      slot independent calculation state.
+        /// @param  getReportApi    returns api report used for a given slot.
+        /// @param  storeReportApi  called once api report for a given slot is calculated.
+        /// @return                 operation status.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename GetReportApi, typename StoreReportApi>
+        ML_INLINE StatusCode CalculateReports(
+            const uint32_t                                       slot,
+            const uint32_t                                       slotsCount,
+            const TT::Queries::HwCountersCalculator::BatchState& batchState,
+            GetReportApi&&                                       getReportApi,
+            StoreReportApi&&                                     storeReportApi )
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
+            for( uint32_t i = 0; i < slotsCount; ++i )
             {
                 // Initialize calculator.
-                TT::Queries::HwCountersCalculator calculator = { getData.Slot + i, query, reportsApi[i] };
+                TT::Queries::HwCountersCalculator calculator = { batchState, slot + i, Derived(), getReportApi( i ) };
 
                 // Validate query calls sequence correctness.
                 if( ML_FAIL( calculator.m_QuerySlot.CheckStateConsistency( T::Queries::HwCountersSlot::State::Resolved ) ) )
@@ -249,8 +682,10 @@ namespace ML::BASE
                     log.Warning( "Unable to obtain query api report for slot index", i, calculationResult );
                 }
 
+                storeReportApi( i );
+
                 // Process calculation status.
-                log.m_Result = query.ProcessCalculationResult( log.m_Result, calculationResult );
+                log.m_Result = ProcessCalculationResult( log.m_Result, calculationResult );
 
                 if( log.m_Result == StatusCode::Failed )
                 {
@@ -261,6 +696,91 @@ namespace ML::BASE
             return log.m_Result;
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns offset of a given compact counter within api report.
+        /// @param  index   counter index.
+        /// @return         counter offset.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static constexpr uint32_t GetCompactCounterOffset( const uint32_t index )
+        {
+            using ReportApi = TT::Layouts::HwCounters::Query::ReportApi;
+
+            constexpr uint32_t hwCountersOffset   = offsetof( ReportApi, m_GpuTicks ) + sizeof( uint64_t );
+            constexpr uint32_t hwCountersCount    = ( offsetof( ReportApi, m_BeginTimestamp ) - hwCountersOffset ) / sizeof( uint64_t );
+            constexpr uint32_t userCountersOffset = offsetof( ReportApi, m_UserCounter );
+
+            return index < hwCountersCount
+                ? hwCountersOffset + index * sizeof( uint64_t )
+                : userCountersOffset + ( index - hwCountersCount ) * sizeof( uint64_t );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Stores api report in compact format.
+        /// @param  reportApi       api report.
+        /// @param  countersOffsets offsets of selected counters within api report.
+        /// @param  output          compact api report output.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static void StoreReportApiCompact(
+            const TT::Layouts::HwCounters::Query::ReportApi& reportApi,
+            const std::vector<uint32_t>&                     countersOffsets,
+            uint8_t*                                         output )
+        {
+            auto& header = *reinterpret_cast<TT::Layouts::HwCounters::Query::ReportApiCompact*>( output );
+
+            header.m_TotalTime      = reportApi.m_TotalTime;
+            header.m_GpuTicks       = reportApi.m_GpuTicks;
+            header.m_BeginTimestamp = reportApi.m_BeginTimestamp;
+            header.m_CoreFrequency  = reportApi.m_CoreFrequency;
+            header.m_ReportId       = reportApi.m_ReportId;
+            header.m_ReportsCount   = reportApi.m_ReportsCount;
+            header.m_Flags          = reportApi.m_Flags;
+            header.m_CountersCount  = static_cast<uint32_t>( countersOffsets.size() );
+
+            const auto source   = reinterpret_cast<const uint8_t*>( &reportApi );
+            auto       counters = reinterpret_cast<uint64_t*>( output + sizeof( header ) );
+
+            for( const uint32_t offset : countersOffsets )
+            {
+                *counters++ = *reinterpret_cast<const uint64_t*>( source + offset );
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Stores api report in structure of arrays format.
+        /// @param  reportApi   api report.
+        /// @param  columns     offsets of requested counters within api report with their columns.
+        /// @param  getData     data requested by client.
+        /// @param  index       api report index within columns.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static void StoreReportApiColumns(
+            const TT::Layouts::HwCounters::Query::ReportApi&   reportApi,
+            const std::vector<std::pair<uint32_t, uint64_t*>>& columns,
+            const GetReportQueryColumns_1_0&                   getData,
+            const uint32_t                                     index )
+        {
+            const auto source = reinterpret_cast<const uint8_t*>( &reportApi );
+
+            for( const auto& [offset, column] : columns )
+            {
+                column[index] = *reinterpret_cast<const uint64_t*>( source + offset );
+            }
+
+            if( getData.TotalTime != nullptr )
+            {
+                getData.TotalTime[index] = reportApi.m_TotalTime;
+            }
+
+            if( getData.GpuTicks != nullptr )
+            {
+                getData.GpuTicks[index] = reportApi.m_GpuTicks;
+            }
+
+            if( getData.Flags != nullptr )
+            {
+                getData.Flags[index] = reportApi.m_Flags.m_Value;
+            }
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Returns query slot for a given index.
         /// @param  slotIndex   slot index.
@@ -274,6 +794,41 @@ namespace ML::BASE
             return m_Slots[slotIndex];
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Locks query slots against background resolve.
+        /// @return lock, not owning a mutex if async resolve is disabled.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::unique_lock<std::mutex> Lock()
+        {
+            return m_Context.m_Resolver.m_Enabled
+                ? std::unique_lock<std::mutex>( m_Mutex )
+                : std::unique_lock<std::mutex>();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Locks slots of two queries against background resolve
+        ///         without deadlocking with a call locking them in reverse.
+        /// @param  first   hw counters query.
+        /// @param  second  hw counters query, may be the same as first.
+        /// @return         locks, not owning mutexes if async resolve is disabled.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static std::pair<std::unique_lock<std::mutex>, std::unique_lock<std::mutex>> Lock(
+            TT::Queries::HwCounters& first,
+            TT::Queries::HwCounters& second )
+        {
+            if( !first.m_Context.m_Resolver.m_Enabled || &first == &second )
+            {
+                return { first.Lock(), std::unique_lock<std::mutex>() };
+            }
+
+            std::unique_lock<std::mutex> lockFirst( first.m_Mutex, std::defer_lock );
+            std::unique_lock<std::mutex> lockSecond( second.m_Mutex, std::defer_lock );
+
+            std::lock( lockFirst, lockSecond );
+
+            return { std::move( lockFirst ), std::move( lockSecond ) };
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Recreates oa report from triggered report from oa buffer.
         /// @param  slot    query slot.
@@ -319,17 +874,149 @@ namespace ML::BASE
                 }
             }
 
-            m_Slots.reserve( slotCount );
-            for( uint32_t i = 0; i < slotCount; ++i )
-            {
-                m_Slots.emplace_back( m_Context );
-            }
+            // Single allocation, all slots are copies of an initial slot.
+            m_Slots.resize( slotCount, TT::Queries::HwCountersSlot( m_Context ) );
 
             return log.m_Result = ( static_cast<uint32_t>( m_Slots.size() ) == slotCount )
                 ? StatusCode::Success
                 : StatusCode::IncorrectParameter;
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Calculates begin/end hw counters commands size. The size is
+        ///         cached per collecting mode, buffer type and markers presence.
+        /// @param  buffer      calculator command buffer.
+        /// @param  data        hw counters data.
+        /// @param  gpuMemory   gpu memory allocation.
+        /// @return             operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode CalculateSize(
+            TT::GpuCommandBufferCalculator&         buffer,
+            const CommandBufferQueryHwCounters_1_0& data,
+            const GpuMemory_1_0&                    gpuMemory )
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
+            uint32_t size = 0;
+
+            ML_FUNCTION_CHECK( GetCommandsSize( buffer.m_Type, data, size ) );
+
+            if( size != 0 )
+            {
+                buffer.m_Usage += size;
+                return log.m_Result;
+            }
+
+            return log.m_Result = WriteCommands( buffer, data, gpuMemory );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns cached begin/end hw counters commands size. Selects
+        ///         collecting mode and user configuration the same way begin
+        ///         commands do, so the size matches the written commands.
+        /// @param  type    command buffer type.
+        /// @param  data    hw counters data.
+        /// @return size    commands size, zero if not known yet.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode GetCommandsSize(
+            const GpuCommandBufferType              type,
+            const CommandBufferQueryHwCounters_1_0& data,
+            uint32_t&                               size )
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
+            auto& slot = GetSlot( data.Slot );
+
+            if( data.Begin )
+            {
+                if constexpr( !T::Policy::QueryHwCounters::Create::m_UserCounters )
+                {
+                    m_UserConfiguration = data.HandleUserConfiguration;
+                }
+
+                DerivedConst().CheckReportCollectingMode( slot );
+            }
+
+            ML_FUNCTION_CHECK( ValidateCommandsCache() );
+
+            const uint32_t index = GetCommandsSizeIndex( slot, type, data );
+
+            size = ( index < m_CommandsSizes.size() )
+                ? m_CommandsSizes[index]
+                : 0;
+
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Writes begin/end hw counters commands and caches their size.
+        /// @param  buffer      target command buffer.
+        /// @param  data        hw counters data.
+        /// @param  gpuMemory   gpu memory allocation.
+        /// @return             operation status.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename CommandBuffer>
+        ML_INLINE StatusCode WriteCommands(
+            CommandBuffer&                          buffer,
+            const CommandBufferQueryHwCounters_1_0& data,
+            const GpuMemory_1_0&                    gpuMemory )
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
+            const uint32_t usage = buffer.m_Usage;
+
+            ML_FUNCTION_CHECK( data.Begin
+                    ? WriteBegin( buffer, data, gpuMemory )
+                    : WriteEnd( buffer, data ) );
+
+            // Collecting mode is known once begin commands are written.
+            const uint32_t index = GetCommandsSizeIndex( GetSlot( data.Slot ), buffer.m_Type, data );
+
+            if( index < m_CommandsSizes.size() )
+            {
+                m_CommandsSizes[index] = buffer.m_Usage - usage;
+            }
+
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns begin/end commands cache variant.
+        /// @param  slot    query slot data.
+        /// @param  type    command buffer type.
+        /// @return         cache variant, m_CommandsVariantsCount if not cached.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static uint32_t GetCommandsVariant(
+            const TT::Queries::HwCountersSlot& slot,
+            const GpuCommandBufferType         type )
+        {
+            const uint32_t mode   = static_cast<uint32_t>( slot.m_ReportCollectingMode );
+            const uint32_t buffer = static_cast<uint32_t>( type );
+
+            return ( mode < m_CollectingModesCount && buffer < m_BufferTypesCount )
+                ? mode * m_BufferTypesCount + buffer
+                : m_CommandsVariantsCount;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns begin/end commands size cache index.
+        /// @param  slot    query slot data.
+        /// @param  type    command buffer type.
+        /// @param  data    hw counters data.
+        /// @return         cache index, out of m_CommandsSizes range if not cached.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static uint32_t GetCommandsSizeIndex(
+            const TT::Queries::HwCountersSlot&      slot,
+            const GpuCommandBufferType              type,
+            const CommandBufferQueryHwCounters_1_0& data )
+        {
+            return ( GetCommandsVariant( slot, type ) << 3 ) |
+                ( ( data.MarkerUser != 0 ) ? 4 : 0 ) |
+                ( ( data.MarkerDriver != 0 ) ? 2 : 0 ) |
+                ( data.Begin ? 1 : 0 );
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Writes begin hw counters commands to command buffer.
         /// @param  buffer      target command buffer.
@@ -373,9 +1060,7 @@ namespace ML::BASE
             const uint64_t gpuAddress = slot.m_GpuMemory.GpuAddress;
 
             ML_FUNCTION_CHECK( FlushCommandStreamer( buffer ) );
-            ML_FUNCTION_CHECK( WriteCoreFrequency<true>( buffer, gpuAddress, slot ) );
-            ML_FUNCTION_CHECK( derived.template WriteUserCounters<true>( buffer, gpuAddress ) );
-            ML_FUNCTION_CHECK( derived.template WriteMertCounters<true>( buffer, gpuAddress ) );
+            ML_FUNCTION_CHECK( WriteCountersTemplate<true>( buffer, gpuAddress, slot ) );
             ML_FUNCTION_CHECK( WriteHwCounters<true>( buffer, gpuAddress, slot ) );
 
             if constexpr( std::is_same<CommandBuffer, TT::GpuCommandBuffer>() )
@@ -401,7 +1086,6 @@ namespace ML::BASE
         {
             ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
 
-            const auto&    derived    = DerivedConst();
             auto&          slot       = GetSlot( data.Slot );
             const uint64_t gpuAddress = slot.m_GpuMemory.GpuAddress;
 
@@ -416,12 +1100,10 @@ namespace ML::BASE
 
             ML_FUNCTION_CHECK( FlushCommandStreamer( buffer ) );
             ML_FUNCTION_CHECK( WriteHwCounters<false>( buffer, gpuAddress, slot ) );
-            ML_FUNCTION_CHECK( derived.template WriteMertCounters<false>( buffer, gpuAddress ) );
-            ML_FUNCTION_CHECK( derived.template WriteUserCounters<false>( buffer, gpuAddress ) );
-            ML_FUNCTION_CHECK( WriteCoreFrequency<false>( buffer, gpuAddress, slot ) );
+            ML_FUNCTION_CHECK( WriteCountersTemplate<false>( buffer, gpuAddress, slot ) );
             ML_FUNCTION_CHECK( WriteUserMarker( buffer, gpuAddress, data.MarkerUser ) );
             ML_FUNCTION_CHECK( WriteDriverMarker( buffer, gpuAddress, data.MarkerDriver ) );
-            ML_FUNCTION_CHECK( WriteEndTag( buffer, gpuAddress, slot ) );
+            ML_FUNCTION_CHECK( WriteEndTag( buffer, slot ) );
 
             if constexpr( std::is_same<CommandBuffer, TT::GpuCommandBuffer>() )
             {
@@ -454,8 +1136,8 @@ namespace ML::BASE
 
             ML_FUNCTION_CHECK( T::GpuCommands::CopyData(
                 buffer,
-                slotSource.m_GpuMemory.GpuAddress + reportGpuEndTagOffset,
-                slotTarget.m_GpuMemory.GpuAddress + reportGpuEndTagOffset,
+                slotSource.m_EndTagGpuAddress,
+                slotTarget.m_EndTagGpuAddress,
                 reportGpuEndTagSize ) );
 
             // Copy query information, excluding the end tag.
@@ -629,6 +1311,124 @@ namespace ML::BASE
             slot.m_GpuMemory.CpuAddress  = static_cast<uint8_t*>( memory.CpuAddress ) + offset;
             slot.m_GpuMemory.GpuAddress += offset;
 
+            // End tag is either a part of the slot report or an entry of the
+            // status array that follows all slot reports.
+            const uint64_t endTagOffset = m_StatusArray
+                ? sizeof( TT::Layouts::HwCounters::Query::ReportGpu ) * m_Slots.size() + sizeof( uint64_t ) * slotIndex
+                : offset + offsetof( TT::Layouts::HwCounters::Query::ReportGpu, m_EndTag );
+
+            slot.m_EndTagCpuAddress = reinterpret_cast<uint64_t*>( static_cast<uint8_t*>( memory.CpuAddress ) + endTagOffset );
+            slot.m_EndTagGpuAddress = memory.GpuAddress + endTagOffset;
+
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Writes core frequency, user and mert counters commands from
+        ///         a template built once per collecting mode and buffer type.
+        ///         Only memory addresses are patched on each call.
+        /// @param  begin       begin/end query.
+        /// @param  buffer      target command buffer.
+        /// @param  gpuAddress  gpu memory address.
+        /// @param  slot        query slot data.
+        /// @return             operation status.
+        //////////////////////////////////////////////////////////////////////////
+        template <bool begin, typename CommandBuffer>
+        ML_INLINE StatusCode WriteCountersTemplate(
+            CommandBuffer&                     buffer,
+            const uint64_t                     gpuAddress,
+            const TT::Queries::HwCountersSlot& slot )
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+            ML_FUNCTION_CHECK( ValidateCommandsCache() );
+
+            const uint32_t variant = GetCommandsVariant( slot, buffer.m_Type );
+
+            if( variant == m_CommandsVariantsCount )
+            {
+                return log.m_Result = WriteCounters<begin>( buffer, gpuAddress, slot );
+            }
+
+            auto& commands = m_CountersTemplates[variant * 2 + ( begin ? 1 : 0 )];
+
+            if( !commands )
+            {
+                auto created = T::Tools::template AllocateUnique<TT::GpuCommandBufferTemplate>( buffer.m_Type, m_Context );
+
+                ML_FUNCTION_CHECK( created != nullptr );
+                ML_FUNCTION_CHECK( WriteCounters<begin>( *created, 0, slot ) );
+
+                commands = std::move( created );
+            }
+
+            return log.m_Result = commands->Emit( buffer, gpuAddress );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Writes core frequency, user and mert counters commands.
+        /// @param  begin       begin/end query.
+        /// @param  buffer      target command buffer.
+        /// @param  gpuAddress  gpu memory address.
+        /// @param  slot        query slot data.
+        /// @return             operation status.
+        //////////////////////////////////////////////////////////////////////////
+        template <bool begin, typename CommandBuffer>
+        ML_INLINE StatusCode WriteCounters(
+            CommandBuffer&                     buffer,
+            const uint64_t                     gpuAddress,
+            const TT::Queries::HwCountersSlot& slot ) const
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
+            const auto& derived = DerivedConst();
+
+            if constexpr( begin )
+            {
+                ML_FUNCTION_CHECK( WriteCoreFrequency<true>( buffer, gpuAddress, slot ) );
+                ML_FUNCTION_CHECK( derived.template WriteUserCounters<true>( buffer, gpuAddress ) );
+                ML_FUNCTION_CHECK( derived.template WriteMertCounters<true>( buffer, gpuAddress ) );
+            }
+            else
+            {
+                ML_FUNCTION_CHECK( derived.template WriteMertCounters<false>( buffer, gpuAddress ) );
+                ML_FUNCTION_CHECK( derived.template WriteUserCounters<false>( buffer, gpuAddress ) );
+                ML_FUNCTION_CHECK( WriteCoreFrequency<false>( buffer, gpuAddress, slot ) );
+            }
+
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Drops counters templates and commands sizes calculated
+        ///         for a different user configuration than the current one.
+        /// @return operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode ValidateCommandsCache()
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
+            uint32_t userRegisters = 0;
+            uint64_t generation    = 0;
+
+            if( m_UserConfiguration.IsValid() )
+            {
+                ML_FUNCTION_CHECK( T::Configurations::HwCountersUser::IsValid( m_UserConfiguration ) );
+
+                const auto& configuration = T::Configurations::HwCountersUser::FromHandle( m_UserConfiguration );
+
+                userRegisters = configuration.m_UserRegisters.m_Handle;
+                generation    = configuration.m_Generation;
+            }
+
+            if( !m_UserConfiguration.IsEqual( m_CommandsCacheConfiguration ) || generation != m_CommandsCacheGeneration || userRegisters != m_CommandsCacheUserRegisters )
+            {
+                m_CountersTemplates = {};
+                m_CommandsSizes.fill( 0 );
+                m_CommandsCacheConfiguration = m_UserConfiguration;
+                m_CommandsCacheGeneration    = generation;
+                m_CommandsCacheUserRegisters = userRegisters;
+            }
+
             return log.m_Result;
         }
 
@@ -664,20 +1464,27 @@ namespace ML::BASE
                 const auto&    userRegisters      = T::Configurations::HwCountersUser::FromHandle( m_UserConfiguration ).m_UserRegisters;
                 const uint32_t userRegistersCount = userRegisters.m_RegistersCount;
 
-                for( uint32_t i = 0; i < userRegistersCount; ++i )
+                for( uint32_t i = 0; i < userRegistersCount; )
                 {
-                    ML_FUNCTION_CHECK( WriteUserCounter<begin>(
-                        buffer,
-                        offset + i * sizeof( uint64_t ),
-                        userRegisters.m_Registers[i].m_Offset ) );
+                    // Each user counter takes 64 bits in memory, so 64 bit registers
+                    // with consecutive addresses form one contiguous range.
+                    const uint32_t first = i;
+                    uint32_t       count = 0;
 
-                    if( userRegisters.m_Registers[i].m_Size > 32 )
+                    do
                     {
-                        ML_FUNCTION_CHECK( WriteUserCounter<begin>(
-                            buffer,
-                            offset + i * sizeof( uint64_t ) + sizeof( uint32_t ),
-                            userRegisters.m_Registers[i].m_Offset + sizeof( uint32_t ) ) );
+                        count += ( userRegisters.m_Registers[i].m_Size > 32 ) ? 2 : 1;
+                        ++i;
                     }
+                    while( i < userRegistersCount &&
+                           count == ( i - first ) * 2 &&
+                           userRegisters.m_Registers[i].m_Offset == userRegisters.m_Registers[i - 1].m_Offset + sizeof( uint64_t ) );
+
+                    ML_FUNCTION_CHECK( WriteUserCounter<begin>(
+                        buffer,
+                        offset + first * sizeof( uint64_t ),
+                        userRegisters.m_Registers[first].m_Offset,
+                        count ) );
                 }
             }
 
@@ -685,18 +1492,20 @@ namespace ML::BASE
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief  Writes mmio user counter.
+        /// @brief  Writes a contiguous range of mmio user counters dwords.
         /// @param  begin           begin/end query.
         /// @param  buffer          target command buffer.
         /// @param  memoryAddress   gpu memory address.
-        /// @param  registerAddress register address.
+        /// @param  registerAddress first register address.
+        /// @param  count           dwords count.
         /// @return                 operation status.
         //////////////////////////////////////////////////////////////////////////
         template <bool begin, typename CommandBuffer>
         ML_INLINE StatusCode WriteUserCounter(
             CommandBuffer& buffer,
             const uint64_t memoryAddress,
-            const uint32_t registerAddress ) const
+            const uint32_t registerAddress,
+            const uint32_t count ) const
         {
             constexpr uint32_t offset = begin
                 ? offsetof( TT::Layouts::HwCounters::Query::ReportGpu, m_Begin.m_User )
@@ -706,10 +1515,11 @@ namespace ML::BASE
                 ? T::GpuCommands::Flags::WorkloadPartition
                 : T::GpuCommands::Flags::None;
 
-            return T::GpuCommands::StoreRegisterToMemory32(
+            return T::GpuCommands::StoreRegistersToMemory32(
                 buffer,
                 registerAddress,
                 memoryAddress + offset,
+                count,
                 flags );
         }
 
@@ -865,18 +1675,14 @@ namespace ML::BASE
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Writes query end tag.
         /// @param  buffer  target command buffer.
-        /// @param  address gpu memory address.
         /// @param  slot    query slot data.
         /// @return         operation status.
         //////////////////////////////////////////////////////////////////////////
         template <typename CommandBuffer>
         ML_INLINE StatusCode WriteEndTag(
             CommandBuffer&                     buffer,
-            const uint64_t                     address,
             const TT::Queries::HwCountersSlot& slot ) const
         {
-            constexpr uint32_t offset = offsetof( TT::Layouts::HwCounters::Query::ReportGpu, m_EndTag );
-
             const auto flags = m_Context.m_ClientOptions.m_WorkloadPartitionEnabled
                 ? T::GpuCommands::Flags::WorkloadPartition
                 : T::GpuCommands::Flags::None;
@@ -884,7 +1690,7 @@ namespace ML::BASE
             return T::GpuCommands::StoreDataToMemory64(
                 buffer,
                 slot.m_EndTag,
-                address + offset,
+                slot.m_EndTagGpuAddress,
                 flags );
         }
 
@@ -1026,19 +1832,48 @@ namespace ML::BASE
             constexpr uint32_t expectedTriggers   = 1;
 
             // Validate triggered oa report.
-            const auto& derived = DerivedConst();
+            const auto&    derived         = DerivedConst();
+            const uint32_t queryIdExpected = derived.template GetQueryId<begin>( queryReport );
 
-            // Number of tries to validate oa report.
-            uint32_t remainingTries = 100;
+            // Use triggered report offset indexed by previous lookups if it is within the oa window.
+            auto&          triggeredReports = oaBuffer.GetTriggeredReports();
+            const uint32_t indexedOffset    = triggeredReports.Find( queryIdExpected );
+
+            if( indexedOffset != Constants::OaBuffer::m_InvalidOffset )
+            {
+                const uint32_t windowSize      = ( reportOaOffsetPost + oaBufferSize - reportOaOffset ) % oaBufferSize;
+                const uint32_t indexedInWindow = ( indexedOffset + oaBufferSize - reportOaOffset ) % oaBufferSize;
+
+                if( indexedInWindow < windowSize )
+                {
+                    const auto& reportOa = oaBuffer.template GetReport<false>( indexedOffset );
+
+                    if( derived.ValidateReportReason( reportOa.m_Header ) &&
+                        derived.ValidateQueryId( reportOa.m_Header, indexedOffset, queryIdExpected ) &&
+                        derived.ValidateGpuTimestamps( queryReport, reportOa ) )
+                    {
+                        reportOaOffset = indexedOffset;
+                    }
+                }
+            }
+
+            // The oa window cannot hold more reports than the oa buffer.
+            uint32_t remainingTries = oaBufferSize / reportSize;
 
             while( !reportOaValid && ( reportOaOffset != reportOaOffsetPost ) )
             {
                 auto& reportOa = oaBuffer.template GetReport<false>( reportOaOffset );
 
-                const uint32_t queryIdExpected = derived.template GetQueryId<begin>( queryReport );
+                const bool validReason = derived.ValidateReportReason( reportOa.m_Header );
+
+                // Index triggered reports, so lookups for next slots do not scan them again.
+                if( validReason && queryIdExpected != 0 )
+                {
+                    triggeredReports.Insert( static_cast<uint32_t>( reportOa.m_Header.m_ContextId ), reportOaOffset );
+                }
 
                 reportOaValid =
-                    derived.ValidateReportReason( reportOa.m_Header ) &&
+                    validReason &&
                     derived.ValidateQueryId( reportOa.m_Header, reportOaOffset, queryIdExpected ) &&
                     derived.ValidateGpuTimestamps( queryReport, reportOa );
 
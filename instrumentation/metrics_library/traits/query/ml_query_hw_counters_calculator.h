@@ -32,12 +32,28 @@ namespace ML::BASE
         using Base::Derived;
         using Base::DerivedConst;
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Calculation state shared by all slots resolved within
+        ///        a single GetData call.
+        //////////////////////////////////////////////////////////////////////////
+        struct BatchState
+        {
+            uint64_t                                         m_GpuOaTimestampFrequency;
+            uint64_t                                         m_GpuCsTimestampFrequency;
+            uint32_t                                         m_OaBufferSize;
+            uint32_t                                         m_OaBufferReportSize;
+            bool                                             m_OaBufferValid;
+            const TT::Layouts::Configuration::UserRegisters* m_UserRegisters;
+        };
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief Members.
         //////////////////////////////////////////////////////////////////////////
+        const BatchState&                               m_BatchState;
         TT::Queries::HwCounters&                        m_Query;
         TT::Context&                                    m_Context;
         TT::Queries::HwCountersSlot&                    m_QuerySlot;
+        const uint64_t                                  m_EndTag;    // Read before gpu report is copied.
         TT::Layouts::HwCounters::Query::ReportGpu       m_ReportGpu;
         TT::Layouts::HwCounters::Report&                m_ReportBegin;
         TT::Layouts::HwCounters::Report&                m_ReportEnd;
@@ -52,18 +68,22 @@ namespace ML::BASE
 
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Hw counters query report constructor.
+        /// @param  batchState  state shared by all slots within a GetData call.
         /// @param  slotIndex   query pool slot index.
         /// @param  query       reference to hw counters query object.
         /// @param  reportApi   reference to output report api.
         //////////////////////////////////////////////////////////////////////////
         QueryHwCountersCalculatorTrait(
+            const BatchState&                          batchState,
             const uint32_t                             slotIndex,
             TT::Queries::HwCounters&                   query,
             TT::Layouts::HwCounters::Query::ReportApi& reportApi )
             : Base()
+            , m_BatchState( batchState )
             , m_Query( query )
             , m_Context( query.m_Context )
             , m_QuerySlot( query.GetSlot( slotIndex ) )
+            , m_EndTag( m_QuerySlot.GetEndTag() )
             , m_ReportGpu( m_QuerySlot.GetReportGpu() )
             , m_ReportBegin( m_ReportGpu.m_Begin )
             , m_ReportEnd( m_ReportGpu.m_End )
@@ -77,8 +97,35 @@ namespace ML::BASE
                   m_QuerySlot.m_ReportCollectingMode == T::Layouts::HwCounters::Query::ReportCollectingMode::TriggerOag || m_QuerySlot.m_ReportCollectingMode == T::Layouts::HwCounters::Query::ReportCollectingMode::TriggerOagExtended
                       ? T::Layouts::Configuration::TimestampType::Oa
                       : T::Layouts::Configuration::TimestampType::Cs )
-            , m_GpuTimestampFrequency( m_Kernel.GetGpuTimestampFrequency( m_TimestampType ) )
+            , m_GpuTimestampFrequency(
+                  m_TimestampType == T::Layouts::Configuration::TimestampType::Oa
+                      ? batchState.m_GpuOaTimestampFrequency
+                      : batchState.m_GpuCsTimestampFrequency )
+        {
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Computes calculation state that does not depend on a query slot.
+        ///         Should be called once per GetData call and shared by all calculators.
+        /// @param  query   reference to hw counters query object.
+        /// @return         batch state.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static BatchState GetBatchState( TT::Queries::HwCounters& query )
         {
+            auto&      context           = query.m_Context;
+            auto&      kernel            = context.m_Kernel;
+            auto&      oaBuffer          = context.m_OaBuffer;
+            const bool userConfiguration = T::Configurations::HwCountersUser::IsValid( query.m_UserConfiguration );
+
+            return BatchState{
+                kernel.GetGpuTimestampFrequency( T::Layouts::Configuration::TimestampType::Oa ),
+                kernel.GetGpuTimestampFrequency( T::Layouts::Configuration::TimestampType::Cs ),
+                oaBuffer.GetSize(),
+                oaBuffer.GetReportSize(),
+                oaBuffer.IsValid(),
+                userConfiguration
+                    ? &T::Configurations::HwCountersUser::FromHandle( query.m_UserConfiguration ).m_UserRegisters
+                    : nullptr };
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -124,6 +171,77 @@ namespace ML::BASE
             return log.m_Result;
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns all multisampled api reports obtained from executed
+        ///         hw counters object. Reports are written starting from the current
+        ///         api report index, so next call resumes if output is too small.
+        /// @param  reportsApi      output api reports.
+        /// @param  reportsCapacity output api reports capacity.
+        /// @return reportsCount    written api reports count.
+        /// @return completed       true if the last api report has been written.
+        /// @return                 operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode GetReportsApiMultisampled(
+            TT::Layouts::HwCounters::Query::ReportApi* reportsApi,
+            const uint32_t                             reportsCapacity,
+            uint32_t&                                  reportsCount,
+            bool&                                      completed )
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+            ML_ASSERT( reportsCapacity > 0 );
+
+            // Clear output report.
+            m_ReportApi  = {};
+            reportsCount = 1;
+            completed    = false;
+
+            // Validate gpu report completeness.
+            if( IsReportGpuReady( log.m_Result ) )
+            {
+                reportsCount = 0;
+
+                // Gpu report is validated once for all subsamples.
+                while( ML_SUCCESS( log.m_Result ) && !completed && reportsCount < reportsCapacity )
+                {
+                    auto& reportApi = reportsApi[reportsCount++];
+
+                    log.m_Result = GetReportMultisampled<false>( reportApi );
+
+                    // Marker data.
+                    reportApi.m_MarkerDriver = m_ReportGpu.m_MarkerDriver;
+                    reportApi.m_MarkerUser   = m_ReportGpu.m_MarkerUser;
+
+                    completed = reportApi.m_ReportId >= reportApi.m_ReportsCount;
+                }
+            }
+            else
+            {
+                // Not processed gpu report is described by the first api report flags.
+                completed = log.m_Result == StatusCode::Success;
+            }
+
+            // Update query slot state if query is resolved.
+            if( ML_SUCCESS( log.m_Result ) )
+            {
+                m_QuerySlot.UpdateState( T::Queries::HwCountersSlot::State::Resolved );
+            }
+
+            log.Debug( "Reports count", reportsCount );
+            log.Debug( "Completed", completed );
+
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns true if oa buffer should be used for a given slot.
+        /// @param  querySlot   query slot.
+        /// @return             true if oa buffer should be used to find context switches.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static bool UseOaBuffer( [[maybe_unused]] const TT::Queries::HwCountersSlot& querySlot )
+        {
+            return true;
+        }
+
     protected:
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Prepares hw counters internal report to evaluate counters values.
@@ -180,17 +298,22 @@ namespace ML::BASE
             // Check if gpu report is ready.
             status = derived.ValidateReportGpu();
 
-            // Prepare gpu report.
-            status = ML_SUCCESS( status ) ? PrepareReportGpu() : status;
+            {
+                // Oa buffer state is shared by calculations of all queries within the context.
+                const auto guard = derived.UseOaBuffer() ? m_OaBuffer.Lock() : std::unique_lock<std::mutex>();
+
+                // Prepare gpu report.
+                status = ML_SUCCESS( status ) ? PrepareReportGpu() : status;
 
-            // Show what has been collected.
-            status = ML_SUCCESS( status ) ? derived.PrintReportGpu() : status;
+                // Show what has been collected.
+                status = ML_SUCCESS( status ) ? derived.PrintReportGpu() : status;
+            }
 
             // Validate gpu report.
             status = ML_SUCCESS( status ) ? ValidateReportGpuWorkload() : status;
 
             // Validate gpu report status.
-            log.m_Result = ValidateReportGpuStatus( status );
+            log.m_Result = ValidateReportGpuStatus( status, m_ReportApi );
 
             // Print report gpu status.
             log.Debug( "Status", status );
@@ -200,18 +323,21 @@ namespace ML::BASE
 
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Validate gpu report status.
-        /// @return status   gpu report validation status.
-        /// @return          success if no issues occurred.
+        /// @param  reportApi   api report that receives report flags.
+        /// @return status      gpu report validation status.
+        /// @return             success if no issues occurred.
         //////////////////////////////////////////////////////////////////////////
-        ML_INLINE bool ValidateReportGpuStatus( StatusCode& status )
+        ML_INLINE bool ValidateReportGpuStatus(
+            StatusCode&                                status,
+            TT::Layouts::HwCounters::Query::ReportApi& reportApi )
         {
             ML_FUNCTION_LOG( true, &m_Context );
 
             // Api report flags.
-            auto& flags = m_ReportApi.m_Flags;
+            auto& flags = reportApi.m_Flags;
             flags       = {};
 
-            flags.m_ReportContextSwitchLost |= !m_OaBuffer.IsValid();
+            flags.m_ReportContextSwitchLost |= !m_BatchState.m_OaBufferValid;
 
             switch( status )
             {
@@ -279,10 +405,10 @@ namespace ML::BASE
         {
             ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
 
-            const bool validTags = m_QuerySlot.m_EndTag == m_ReportGpu.m_EndTag;
+            const bool validTags = m_QuerySlot.m_EndTag == m_EndTag;
 
             log.Debug( "Valid tags   ", validTags );
-            log.Debug( "    obtained ", m_ReportGpu.m_EndTag );
+            log.Debug( "    obtained ", m_EndTag );
             log.Debug( "    expected ", m_QuerySlot.m_EndTag );
 
             return log.m_Result = validTags
@@ -361,6 +487,11 @@ namespace ML::BASE
 
             if( useOaBuffer )
             {
+                // Oa buffer state is shared by calculations of all queries within the context.
+                // Found begin & end reports are owned by the calculator or the query slot,
+                // so counters are calculated without the lock.
+                const auto guard = m_OaBuffer.Lock();
+
                 // Find appropriate begin & end reports.
                 do
                 {
@@ -399,7 +530,7 @@ namespace ML::BASE
                         log.m_Result = StatusCode::ReportInconsistent;
 
                         // Validate gpu report consistency.
-                        ML_FUNCTION_CHECK( ValidateReportGpuStatus( log.m_Result ) );
+                        ML_FUNCTION_CHECK( ValidateReportGpuStatus( log.m_Result, isExtendedQuery ? m_ReportApi : reportApi ) );
                     }
                 }
             }
@@ -408,36 +539,25 @@ namespace ML::BASE
             ML_FUNCTION_CHECK( GetFrequencyGpu( reportApi.m_CoreFrequencyChanged, reportApi.m_CoreFrequency ) );
             ML_FUNCTION_CHECK( GetFrequencySlice( frequency, reportApi ) );
 
-            // Gpu counters.
-            TT::Layouts::HwCounters::Report reportBegin = {};
-            TT::Layouts::HwCounters::Report reportEnd   = {};
-
-            // Copy oa reports.
-            reportBegin.m_Oa = *oaBegin;
-            reportEnd.m_Oa   = *oaEnd;
-
-            CalculateCounters<true, false>(
-                reportBegin,
-                reportEnd,
-                reportApi );
+            // Gpu counters. Oa reports are used in place, either straight from
+            // the mapped oa buffer or from the report copies kept for overrun
+            // detection, so no additional copy is made here.
+            derived.AdjustOaCounters( *oaBegin, *oaEnd, reportApi );
 
             if constexpr( !isExtendedQuery )
             {
-                log.Info( "Report begin (oa):", reportBegin.m_Oa );
-                log.Info( "Report end   (oa):", reportEnd.m_Oa );
+                log.Info( "Report begin (oa):", *oaBegin );
+                log.Info( "Report end   (oa):", *oaEnd );
 
                 // If there is more than one report in the query (tbs multi samples type only),
                 // user counters need to be calculated separately using timestamps
                 // from snapshots as the time range.
                 // Only approximated (average) values are available, because user counters
                 // are not collected in oa buffer.
-                reportBegin.m_Oa.m_Header.m_Timestamp = m_ReportGpu.m_Begin.m_Oa.m_Header.m_Timestamp;
-                reportEnd.m_Oa.m_Header.m_Timestamp   = m_ReportGpu.m_End.m_Oa.m_Header.m_Timestamp;
+                const TT::Layouts::HwCounters::Report reportEmpty = {};
 
-                CalculateCounters<false, true>(
-                    reportBegin,
-                    reportEnd,
-                    reportApi );
+                derived.AdjustUserCounters( reportEmpty.m_User, reportEmpty.m_User, reportApi );
+                derived.AdjustMertCounters( reportEmpty, reportEmpty, reportApi );
             }
 
             reportApi.m_MiddleQueryEvents = events;
@@ -562,35 +682,6 @@ namespace ML::BASE
             return log.m_Result;
         }
 
-        //////////////////////////////////////////////////////////////////////////
-        /// @brief  Calculates counters delta values between two reports.
-        ///         Handles context switches which can occur between reports.
-        /// @param  calculateOa     flag to indicate if oa counters need to be calculated.
-        /// @param  calculateUser   flag to indicate if user counters need to be calculated.
-        /// @param  begin           begin hw counters report.
-        /// @param  end             end hw counters report.
-        /// @return reportApi       api report.
-        //////////////////////////////////////////////////////////////////////////
-        template <bool calculateOa, bool calculateUser>
-        ML_INLINE void CalculateCounters(
-            const TT::Layouts::HwCounters::Report&     begin,
-            const TT::Layouts::HwCounters::Report&     end,
-            TT::Layouts::HwCounters::Query::ReportApi& reportApi ) const
-        {
-            const auto& derived = DerivedConst();
-
-            if constexpr( calculateOa )
-            {
-                derived.AdjustOaCounters( begin.m_Oa, end.m_Oa, reportApi );
-            }
-
-            if constexpr( calculateUser )
-            {
-                derived.AdjustUserCounters( begin.m_User, end.m_User, reportApi );
-                derived.AdjustMertCounters( begin, end, reportApi );
-            }
-        }
-
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Function used to sum oa and noa counters between two reports.
         /// @param  begin       begin internal hw counters report.
@@ -636,9 +727,9 @@ namespace ML::BASE
         {
             ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
 
-            if( T::Configurations::HwCountersUser::IsValid( m_UserConfiguration ) )
+            if( m_BatchState.m_UserRegisters != nullptr )
             {
-                const auto&    registers = T::Configurations::HwCountersUser::FromHandle( m_UserConfiguration ).m_UserRegisters;
+                const auto&    registers = *m_BatchState.m_UserRegisters;
                 const uint32_t count     = registers.m_RegistersCount;
 
                 for( uint32_t i = 0; i < count; ++i )
@@ -754,19 +845,18 @@ namespace ML::BASE
             const TT::Layouts::HwCounters::ReportOa&   end,
             TT::Layouts::HwCounters::Query::ReportApi& reportApi ) const
         {
-            for( uint32_t i = 0; i < T::Layouts::HwCounters::m_OaCountersCount; ++i )
+            // A0 - A31 counters are 40 bits counters.
+            for( uint32_t i = 0; i < T::Layouts::HwCounters::m_OaCounters40bitsCount; ++i )
             {
-                if( i < T::Layouts::HwCounters::m_OaCounters40bitsCount )
-                {
-                    const uint64_t counterBegin = static_cast<uint64_t>( begin.m_Data.m_OaCounter[i] ) + ( static_cast<uint64_t>( begin.m_Data.m_OaCounterHB[i] ) << 32 );
-                    const uint64_t counterEnd   = static_cast<uint64_t>( end.m_Data.m_OaCounter[i] ) + ( static_cast<uint64_t>( end.m_Data.m_OaCounterHB[i] ) << 32 );
+                const uint64_t counterBegin = static_cast<uint64_t>( begin.m_Data.m_OaCounter[i] ) + ( static_cast<uint64_t>( begin.m_Data.m_OaCounterHB[i] ) << 32 );
+                const uint64_t counterEnd   = static_cast<uint64_t>( end.m_Data.m_OaCounter[i] ) + ( static_cast<uint64_t>( end.m_Data.m_OaCounterHB[i] ) << 32 );
 
-                    reportApi.m_OaCounter[i] = T::Tools::CountersDelta( counterEnd, counterBegin, 40 );
-                }
-                else
-                {
-                    reportApi.m_OaCounter[i] = T::Tools::CountersDelta( end.m_Data.m_OaCounter[i], begin.m_Data.m_OaCounter[i], 32 );
-                }
+                reportApi.m_OaCounter[i] = T::Tools::template CountersDelta<40>( counterEnd, counterBegin );
+            }
+
+            for( uint32_t i = T::Layouts::HwCounters::m_OaCounters40bitsCount; i < T::Layouts::HwCounters::m_OaCountersCount; ++i )
+            {
+                reportApi.m_OaCounter[i] = T::Tools::template CountersDelta<32>( end.m_Data.m_OaCounter[i], begin.m_Data.m_OaCounter[i] );
             }
         }
 
@@ -783,7 +873,7 @@ namespace ML::BASE
         {
             for( uint32_t i = 0; i < T::Layouts::HwCounters::m_NoaCountersCount; ++i )
             {
-                reportApi.m_NoaCounter[i] = T::Tools::CountersDelta( end.m_Data.m_NoaCounter[i], begin.m_Data.m_NoaCounter[i], 32 );
+                reportApi.m_NoaCounter[i] = T::Tools::template CountersDelta<32>( end.m_Data.m_NoaCounter[i], begin.m_Data.m_NoaCounter[i] );
             }
         }
 
@@ -942,28 +1032,41 @@ namespace ML::BASE
             ML_ASSERT( m_OaBufferState.m_CurrentOffset == Constants::OaBuffer::m_InvalidOffset );
 
             // Check if oa buffer contains reports.
-            if( !m_OaBuffer.IsValid() )
+            if( !m_BatchState.m_OaBufferValid )
             {
                 log.Warning( "Oa buffer is not available." );
             }
             else
             {
                 // Oa reports.
-                const uint32_t oaBufferSize   = m_OaBuffer.GetSize();
-                const uint32_t reportSize     = m_OaBuffer.GetReportSize();
+                const uint32_t oaBufferSize   = m_BatchState.m_OaBufferSize;
+                const uint32_t reportSize     = m_BatchState.m_OaBufferReportSize;
                 const uint32_t oaReportsCount = m_OaBuffer.FindOaWindow( m_OaBufferState );
 
+                // Reports between the rolled back context switch and the last report before
+                // query begin contain neither context switches for the measured command streamer
+                // nor query reports, so only the context switch and the last report are parsed.
+                // Roll back guarantees it: it stops at the first such context switch found
+                // backwards from the pre begin tail, or at a cached one known to have none
+                // after it up to the scanned offset. Skipped reports precede query begin,
+                // so they could only set the frequency, which the last report overrides.
+                const uint32_t rolledBackCount = ( m_OaBufferState.m_TailPreBeginOffset + oaBufferSize - m_OaBufferState.m_TailPreBeginOffsetRolledBack ) % oaBufferSize / reportSize;
+                const uint32_t skippedCount    = ( rolledBackCount > 2 ) ? rolledBackCount - 2 : 0;
+
                 auto& derived = Derived();
 
                 uint32_t currentContextId = Constants::Query::m_DummyContextId;
 
-                for( uint32_t i = 0; i < oaReportsCount; ++i )
+                for( uint32_t i = 0; i < oaReportsCount; i = ( i == 0 ) ? 1 + skippedCount : i + 1 )
                 {
                     const uint32_t oaReportOffset = ( m_OaBufferState.m_TailPreBeginOffsetRolledBack + ( i * reportSize ) ) % oaBufferSize;
                     const auto&    oaReport       = m_OaBuffer.template GetReport<false>( oaReportOffset );
 
                     derived.SetContextIds( oaReport, currentContextId );
 
+                    // Reports are skipped only after the rolled back context switch.
+                    ML_ASSERT( i != 0 || skippedCount == 0 || currentContextId != Constants::Query::m_DummyContextId );
+
                     if( derived.CompareTimestamps( oaReport.m_Header.m_Timestamp, reportBegin.m_Header.m_Timestamp ) <= 0 )
                     {
                         frequency = oaReport.m_Header.m_ReportId;
@@ -1045,7 +1148,7 @@ namespace ML::BASE
             else
             {
                 // Set to the previous end report.
-                const uint32_t reportSize = m_OaBuffer.GetReportSize();
+                const uint32_t reportSize = m_BatchState.m_OaBufferReportSize;
 
                 reportBegin = &m_OaBufferState.m_ReportCopy[m_OaBufferState.m_ReportCopyIndex];
                 frequency   = reportBegin->m_Header.m_ReportId;
@@ -1071,7 +1174,7 @@ namespace ML::BASE
         {
             ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
 
-            const uint32_t oaBufferSize = m_OaBuffer.GetSize();
+            const uint32_t oaBufferSize = m_BatchState.m_OaBufferSize;
 
             if( !oaBufferSize )
             {
@@ -1129,7 +1232,7 @@ namespace ML::BASE
         {
             ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
 
-            const uint32_t oaBufferSize = m_OaBuffer.GetSize();
+            const uint32_t oaBufferSize = m_BatchState.m_OaBufferSize;
 
             if( !oaBufferSize )
             {
@@ -1149,7 +1252,7 @@ namespace ML::BASE
                 }
                 else
                 {
-                    const uint32_t reportSize       = m_OaBuffer.GetReportSize();
+                    const uint32_t reportSize       = m_BatchState.m_OaBufferReportSize;
                     m_OaBufferState.m_CurrentOffset = ( m_OaBufferState.m_CurrentOffset + reportSize ) % oaBufferSize;
                 }
             }
@@ -1204,7 +1307,7 @@ namespace ML::BASE
         //////////////////////////////////////////////////////////////////////////
         ML_INLINE bool UseOaBuffer() const
         {
-            return true;
+            return T::Queries::HwCountersCalculator::UseOaBuffer( m_QuerySlot );
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -1255,8 +1358,10 @@ namespace ML::XE_HPG
         using Base::DerivedConst;
         using Base::EqualOaReport;
         using Base::IsMeasuredContextId;
+        using Base::m_BatchState;
         using Base::m_CommandBufferType;
         using Base::m_Context;
+        using Base::m_EndTag;
         using Base::m_ReportGpu;
         using Base::m_ReportBegin;
         using Base::m_ReportEnd;
@@ -1275,36 +1380,50 @@ namespace ML::XE_HPG
             const TT::Layouts::HwCounters::ReportOa&   end,
             TT::Layouts::HwCounters::Query::ReportApi& reportApi ) const
         {
-            for( uint32_t i = 0; i < T::Layouts::HwCounters::m_OagCountersCount; ++i )
+            using Layout = TT::Layouts::HwCounters;
+
+            // A0 - A3 counters are 32 bits counters.
+            for( uint32_t i = 0; i < Layout::m_OaCounter4; ++i )
             {
-                // A4 - A23 and A28 - A31 counters are only 40 bits counters.
-                if( i >= T::Layouts::HwCounters::m_OaCounter4 && i <= T::Layouts::HwCounters::m_OaCounter23 )
-                {
-                    const uint32_t highBitsIndex = i - T::Layouts::HwCounters::m_OaCounter4;
+                reportApi.m_OaCounter[i] = T::Tools::template CountersDelta<32>( end.m_Data.m_OaCounter_0_36[i], begin.m_Data.m_OaCounter_0_36[i] );
+            }
 
-                    const uint64_t counterBegin = static_cast<uint64_t>( begin.m_Data.m_OaCounter_0_36[i] ) + ( static_cast<uint64_t>( begin.m_Data.m_OaCounterHB_4_23[highBitsIndex] ) << 32 );
-                    const uint64_t counterEnd   = static_cast<uint64_t>( end.m_Data.m_OaCounter_0_36[i] ) + ( static_cast<uint64_t>( end.m_Data.m_OaCounterHB_4_23[highBitsIndex] ) << 32 );
+            // A4 - A23 counters are 40 bits counters.
+            for( uint32_t i = Layout::m_OaCounter4; i <= Layout::m_OaCounter23; ++i )
+            {
+                const uint32_t highBitsIndex = i - Layout::m_OaCounter4;
 
-                    reportApi.m_OaCounter[i] = T::Tools::CountersDelta( counterEnd, counterBegin, 40 );
-                }
-                else if( i >= T::Layouts::HwCounters::m_OaCounter28 && i <= T::Layouts::HwCounters::m_OaCounter31 )
-                {
-                    const uint32_t highBitsIndex = i - T::Layouts::HwCounters::m_OaCounter28;
+                const uint64_t counterBegin = static_cast<uint64_t>( begin.m_Data.m_OaCounter_0_36[i] ) + ( static_cast<uint64_t>( begin.m_Data.m_OaCounterHB_4_23[highBitsIndex] ) << 32 );
+                const uint64_t counterEnd   = static_cast<uint64_t>( end.m_Data.m_OaCounter_0_36[i] ) + ( static_cast<uint64_t>( end.m_Data.m_OaCounterHB_4_23[highBitsIndex] ) << 32 );
 
-                    const uint64_t counterBegin = static_cast<uint64_t>( begin.m_Data.m_OaCounter_0_36[i] ) + ( static_cast<uint64_t>( begin.m_Data.m_OaCounterHB_28_31[highBitsIndex] ) << 32 );
-                    const uint64_t counterEnd   = static_cast<uint64_t>( end.m_Data.m_OaCounter_0_36[i] ) + ( static_cast<uint64_t>( end.m_Data.m_OaCounterHB_28_31[highBitsIndex] ) << 32 );
+                reportApi.m_OaCounter[i] = T::Tools::template CountersDelta<40>( counterEnd, counterBegin );
+            }
 
-                    reportApi.m_OaCounter[i] = T::Tools::CountersDelta( counterEnd, counterBegin, 40 );
-                }
-                else if( i <= T::Layouts::HwCounters::m_OaCounter36 )
-                {
-                    reportApi.m_OaCounter[i] = T::Tools::CountersDelta( end.m_Data.m_OaCounter_0_36[i], begin.m_Data.m_OaCounter_0_36[i], 32 );
-                }
-                else
-                {
-                    reportApi.m_OaCounter[i] = T::Tools::CountersDelta( end.m_Data.m_OaCounter_37, begin.m_Data.m_OaCounter_37, 32 );
-                }
+            // A24 - A27 counters are 32 bits counters.
+            for( uint32_t i = Layout::m_OaCounter23 + 1; i < Layout::m_OaCounter28; ++i )
+            {
+                reportApi.m_OaCounter[i] = T::Tools::template CountersDelta<32>( end.m_Data.m_OaCounter_0_36[i], begin.m_Data.m_OaCounter_0_36[i] );
             }
+
+            // A28 - A31 counters are 40 bits counters.
+            for( uint32_t i = Layout::m_OaCounter28; i <= Layout::m_OaCounter31; ++i )
+            {
+                const uint32_t highBitsIndex = i - Layout::m_OaCounter28;
+
+                const uint64_t counterBegin = static_cast<uint64_t>( begin.m_Data.m_OaCounter_0_36[i] ) + ( static_cast<uint64_t>( begin.m_Data.m_OaCounterHB_28_31[highBitsIndex] ) << 32 );
+                const uint64_t counterEnd   = static_cast<uint64_t>( end.m_Data.m_OaCounter_0_36[i] ) + ( static_cast<uint64_t>( end.m_Data.m_OaCounterHB_28_31[highBitsIndex] ) << 32 );
+
+                reportApi.m_OaCounter[i] = T::Tools::template CountersDelta<40>( counterEnd, counterBegin );
+            }
+
+            // A32 - A36 counters are 32 bits counters.
+            for( uint32_t i = Layout::m_OaCounter31 + 1; i <= Layout::m_OaCounter36; ++i )
+            {
+                reportApi.m_OaCounter[i] = T::Tools::template CountersDelta<32>( end.m_Data.m_OaCounter_0_36[i], begin.m_Data.m_OaCounter_0_36[i] );
+            }
+
+            // A37 counter is stored separately.
+            reportApi.m_OaCounter[Layout::m_OaCounter37] = T::Tools::template CountersDelta<32>( end.m_Data.m_OaCounter_37, begin.m_Data.m_OaCounter_37 );
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -1470,13 +1589,13 @@ namespace ML::XE_HPG
             ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
 
             const auto& derived              = DerivedConst();
-            const bool  validTags            = m_QuerySlot.m_EndTag == m_ReportGpu.m_EndTag;
+            const bool  validTags            = m_QuerySlot.m_EndTag == m_EndTag;
             const bool  validCommandStreamer = m_ReportGpu.m_CommandStreamerIdentificator > 0;
             const bool  validMirpc           = derived.IsMirpcCompleted();
             const bool  validQueryMode       = derived.IsQueryModeValid();
 
             log.Debug( "Valid tags       ", validTags );
-            log.Debug( "    obtained     ", m_ReportGpu.m_EndTag );
+            log.Debug( "    obtained     ", m_EndTag );
             log.Debug( "    expected     ", m_QuerySlot.m_EndTag );
             log.Debug( "Command streamer ", m_ReportGpu.m_CommandStreamerIdentificator );
             log.Debug( "Valid mirpc      ", validMirpc );
@@ -1536,8 +1655,8 @@ namespace ML::XE_HPG
                 ", PreEnd =", oaTailPreEndOffset,
                 ", PostEnd =", oaTailPostEndOffset );
 
-            const uint32_t reportSize   = m_OaBuffer.GetReportSize();
-            const uint32_t oaBufferSize = m_OaBuffer.GetSize();
+            const uint32_t reportSize   = m_BatchState.m_OaBufferReportSize;
+            const uint32_t oaBufferSize = m_BatchState.m_OaBufferSize;
             const uint32_t oaWindowSize = ( oaTailPreBeginOffset > oaTailPostEndOffset )
                 ? ( oaTailPostEndOffset + ( oaBufferSize - oaTailPreBeginOffset ) ) / reportSize
                 : ( oaTailPostEndOffset - oaTailPreBeginOffset ) / reportSize;
@@ -1602,6 +1721,7 @@ namespace ML::XE2_HPG
         using Base::m_ReportEnd;
         using Base::m_ReportGpu;
         using Base::m_TimestampType;
+        using Base::UseOaBuffer;
 
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Function used to sum oa counters between two reports.
@@ -1744,7 +1864,7 @@ namespace ML::XE2_HPG
         {
             for( uint32_t i = 0; i < T::Layouts::HwCounters::m_PerformanceEventCountersCount; ++i )
             {
-                reportApi.m_PerformanceEventCounter[i] = T::Tools::CountersDelta( end.m_Data.m_PerformanceEventCounter[i], begin.m_Data.m_PerformanceEventCounter[i], 64 );
+                reportApi.m_PerformanceEventCounter[i] = T::Tools::template CountersDelta<64>( end.m_Data.m_PerformanceEventCounter[i], begin.m_Data.m_PerformanceEventCounter[i] );
             }
         }
 
@@ -1761,7 +1881,7 @@ namespace ML::XE2_HPG
         {
             for( uint32_t i = 0; i < T::Layouts::HwCounters::m_VisaCountersCount; ++i )
             {
-                reportApi.m_VisaCounter[i] = T::Tools::CountersDelta( end.m_Data.m_VisaCounter[i], begin.m_Data.m_VisaCounter[i], 32 );
+                reportApi.m_VisaCounter[i] = T::Tools::template CountersDelta<32>( end.m_Data.m_VisaCounter[i], begin.m_Data.m_VisaCounter[i] );
             }
         }
 
@@ -1832,13 +1952,14 @@ namespace ML::XE2_HPG
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief  Returns true if oa buffer should be used.
-        /// @return true if oa buffer should be used to find context switches.
+        /// @brief  Returns true if oa buffer should be used for a given slot.
+        /// @param  querySlot   query slot.
+        /// @return             true if oa buffer should be used to find context switches.
         //////////////////////////////////////////////////////////////////////////
-        ML_INLINE bool UseOaBuffer() const
+        ML_INLINE static bool UseOaBuffer( const TT::Queries::HwCountersSlot& querySlot )
         {
-            return m_QuerySlot.m_ReportCollectingMode == T::Layouts::HwCounters::Query::ReportCollectingMode::TriggerOag ||
-                m_QuerySlot.m_ReportCollectingMode == T::Layouts::HwCounters::Query::ReportCollectingMode::TriggerOagExtended;
+            return querySlot.m_ReportCollectingMode == T::Layouts::HwCounters::Query::ReportCollectingMode::TriggerOag ||
+                querySlot.m_ReportCollectingMode == T::Layouts::HwCounters::Query::ReportCollectingMode::TriggerOagExtended;
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,566 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2026 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+/*
+@file ml_query_hw_counters_resolver.h
+
+@brief Resolves hw counters queries in background. Ready query slots of
+       all registered queries are calculated into a lock-free ring of api
+       reports that client threads drain with get data requests.
+*/
+
+#pragma once
+
+namespace ML
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Base type for QueryHwCountersResolverTrait object.
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct QueryHwCountersResolverTrait
+    {
+        ML_DELETE_DEFAULT_CONSTRUCTOR( QueryHwCountersResolverTrait );
+        ML_DELETE_DEFAULT_COPY_AND_MOVE( QueryHwCountersResolverTrait );
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Resolved api report.
+        //////////////////////////////////////////////////////////////////////////
+        struct Result
+        {
+            QueryHandle_1_0                           m_Query;
+            uint64_t                                  m_Generation;        // Query generation, its memory can be reused.
+            uint64_t                                  m_UnregisteredCount; // Unregistered queries count when resolved.
+            uint32_t                                  m_Slot;
+            TT::Layouts::HwCounters::Query::ReportApi m_ReportApi;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Bounded multi producer / multi consumer lock-free ring.
+        ///        Each cell sequence tells whether the cell is free for
+        ///        a given enqueue position or filled for a given dequeue
+        ///        position, so producers and consumers only compete on
+        ///        their own position counter.
+        //////////////////////////////////////////////////////////////////////////
+        struct Ring
+        {
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Ring cell.
+            //////////////////////////////////////////////////////////////////////////
+            struct Cell
+            {
+                std::atomic<uint64_t> m_Sequence;
+                Result                m_Result;
+            };
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Members.
+            //////////////////////////////////////////////////////////////////////////
+            std::unique_ptr<Cell[]>             m_Cells;
+            uint64_t                            m_Mask;
+            alignas( 64 ) std::atomic<uint64_t> m_EnqueuePosition; // Separate cache lines avoid false sharing
+            alignas( 64 ) std::atomic<uint64_t> m_DequeuePosition; // between producers and consumers.
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Ring constructor.
+            //////////////////////////////////////////////////////////////////////////
+            Ring()
+                : m_Cells{}
+                , m_Mask( 0 )
+                , m_EnqueuePosition( 0 )
+                , m_DequeuePosition( 0 )
+            {
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief  Allocates ring cells.
+            /// @param  count   requested cells count, rounded up to a power of two.
+            /// @return         true if cells have been allocated.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE bool Initialize( const uint32_t count )
+            {
+                uint64_t capacity = 1;
+
+                while( capacity < count )
+                {
+                    capacity <<= 1;
+                }
+
+                m_Cells = std::unique_ptr<Cell[]>( new( std::nothrow ) Cell[capacity] );
+                m_Mask  = capacity - 1;
+
+                for( uint64_t i = 0; m_Cells && i < capacity; ++i )
+                {
+                    m_Cells[i].m_Sequence.store( i, std::memory_order_relaxed );
+                }
+
+                return m_Cells != nullptr;
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief  Checks if the next enqueue will succeed. Exact when called
+            ///         by the only producer, since consumers can only release
+            ///         the cell, so it is checked before a report is calculated.
+            /// @return true if the cell at enqueue position is free.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE bool CanEnqueue() const
+            {
+                const uint64_t position = m_EnqueuePosition.load( std::memory_order_relaxed );
+
+                return m_Cells[position & m_Mask].m_Sequence.load( std::memory_order_acquire ) == position;
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief  Adds result to the ring.
+            /// @param  result  result to add.
+            /// @return         false if ring is full.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE bool Enqueue( const Result& result )
+            {
+                uint64_t position = m_EnqueuePosition.load( std::memory_order_relaxed );
+                Cell*    cell     = nullptr;
+
+                while( true )
+                {
+                    cell = &m_Cells[position & m_Mask];
+
+                    const uint64_t sequence = cell->m_Sequence.load( std::memory_order_acquire );
+                    const int64_t  distance = static_cast<int64_t>( sequence - position );
+
+                    if( distance == 0 )
+                    {
+                        if( m_EnqueuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+                        {
+                            break;
+                        }
+                    }
+                    else if( distance < 0 )
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_EnqueuePosition.load( std::memory_order_relaxed );
+                    }
+                }
+
+                cell->m_Result = result;
+                cell->m_Sequence.store( position + 1, std::memory_order_release );
+
+                return true;
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief  Removes the oldest result from the ring.
+            /// @return result  removed result.
+            /// @return         false if ring is empty.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE bool Dequeue( Result& result )
+            {
+                uint64_t position = m_DequeuePosition.load( std::memory_order_relaxed );
+                Cell*    cell     = nullptr;
+
+                while( true )
+                {
+                    cell = &m_Cells[position & m_Mask];
+
+                    const uint64_t sequence = cell->m_Sequence.load( std::memory_order_acquire );
+                    const int64_t  distance = static_cast<int64_t>( sequence - ( position + 1 ) );
+
+                    if( distance == 0 )
+                    {
+                        if( m_DequeuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+                        {
+                            break;
+                        }
+                    }
+                    else if( distance < 0 )
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_DequeuePosition.load( std::memory_order_relaxed );
+                    }
+                }
+
+                result = cell->m_Result;
+                cell->m_Sequence.store( position + m_Mask + 1, std::memory_order_release );
+
+                return true;
+            }
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Members.
+        //////////////////////////////////////////////////////////////////////////
+        TT::Context&                                  m_Context;
+        bool                                          m_Enabled;      // Set by async resolve client option.
+        bool                                          m_Exit;         // Requests background thread to exit.
+        bool                                          m_Wake;         // Requests background thread to resolve.
+        std::unordered_set<TT::Queries::HwCounters*>  m_Queries;      // Queries watched for ready slots.
+        std::atomic<uint64_t>                         m_Unregistered; // Unregistered queries count.
+        Ring                                          m_Results;      // Resolved api reports.
+        std::mutex                                    m_Mutex;        // Guards registered queries, slots are guarded by query mutexes.
+        std::mutex                                    m_WakeMutex;    // Guards wake and exit requests.
+        std::condition_variable                       m_Condition;
+        std::thread                                   m_Thread;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief QueryHwCountersResolverTrait constructor.
+        /// @param context  context.
+        //////////////////////////////////////////////////////////////////////////
+        QueryHwCountersResolverTrait( TT::Context& context )
+            : m_Context( context )
+            , m_Enabled( false )
+            , m_Exit( false )
+            , m_Wake( false )
+            , m_Queries{}
+            , m_Unregistered( 0 )
+            , m_Results{}
+        {
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief QueryHwCountersResolverTrait destructor.
+        //////////////////////////////////////////////////////////////////////////
+        ~QueryHwCountersResolverTrait()
+        {
+            Release();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Starts background resolve if requested by client options.
+        /// @return operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode Initialize()
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
+            const auto& options = m_Context.m_ClientOptions;
+
+            if( !options.m_AsyncResolveEnabled )
+            {
+                return log.m_Result;
+            }
+
+            ML_FUNCTION_CHECK( options.m_AsyncResolveReportsCount > 0 );
+
+            ML_FUNCTION_CHECK( m_Results.Initialize( options.m_AsyncResolveReportsCount ) );
+
+            m_Enabled = true;
+
+#if ML_RELEASE
+            try
+            {
+                m_Thread = std::thread( [this]() { Run(); } );
+            }
+            catch( const std::system_error& )
+            {
+                // Ready slots are resolved on demand by get data requests instead.
+                log.Warning( "Unable to start background resolve thread" );
+            }
+#endif // ML_RELEASE
+
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Stops background resolve.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void Release()
+        {
+            if( m_Thread.joinable() )
+            {
+                {
+                    std::lock_guard<std::mutex> guard( m_WakeMutex );
+                    m_Exit = true;
+                }
+
+                m_Condition.notify_one();
+                m_Thread.join();
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Wakes up background resolve after a query slot has ended.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void Notify()
+        {
+            if( m_Thread.joinable() )
+            {
+                {
+                    std::lock_guard<std::mutex> guard( m_WakeMutex );
+                    m_Wake = true;
+                }
+
+                m_Condition.notify_one();
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Adds query to queries watched for ready slots.
+        /// @param query    hw counters query.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void Register( TT::Queries::HwCounters& query )
+        {
+            if( m_Enabled )
+            {
+                std::lock_guard<std::mutex> guard( m_Mutex );
+                m_Queries.insert( &query );
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Removes query from queries watched for ready slots.
+        ///        Waits until an ongoing resolve pass completes.
+        /// @param query    hw counters query.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void Unregister( TT::Queries::HwCounters& query )
+        {
+            if( m_Enabled )
+            {
+                std::lock_guard<std::mutex> guard( m_Mutex );
+                m_Queries.erase( &query );
+                m_Unregistered.fetch_add( 1, std::memory_order_release );
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns api reports resolved in background. Does not block,
+        ///         multiple client threads can drain the reports concurrently.
+        /// @return getData data requested by client.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static StatusCode GetData( GetReportQueryAsync_1_0& getData )
+        {
+            ML_FUNCTION_CHECK_STATIC( getData.Data != nullptr );
+            ML_FUNCTION_CHECK_STATIC( getData.DataSize % sizeof( TT::Layouts::HwCounters::Query::ReportApi ) == 0 );
+            ML_FUNCTION_CHECK_STATIC( T::Context::IsValid( getData.Handle ) );
+
+            auto& resolver = T::Context::FromHandle( getData.Handle ).m_Resolver;
+            ML_FUNCTION_LOG( StatusCode::Success, &resolver.m_Context );
+            ML_FUNCTION_CHECK( resolver.m_Enabled );
+
+            auto           reportsApi      = static_cast<TT::Layouts::HwCounters::Query::ReportApi*>( getData.Data );
+            const uint32_t reportsCapacity = getData.DataSize / sizeof( TT::Layouts::HwCounters::Query::ReportApi );
+
+            // Without a background thread ready slots are resolved on demand,
+            // unless another client thread is resolving them already.
+            if( !resolver.m_Thread.joinable() )
+            {
+                std::unique_lock<std::mutex> lock( resolver.m_Mutex, std::try_to_lock );
+
+                if( lock.owns_lock() )
+                {
+                    resolver.Resolve();
+                }
+            }
+
+            Result result = {};
+
+            getData.ReportsCount = 0;
+
+            while( getData.ReportsCount < reportsCapacity && resolver.m_Results.Dequeue( result ) )
+            {
+                // Reports of deleted queries are dropped.
+                if( !resolver.IsRegistered( result ) )
+                {
+                    continue;
+                }
+
+                reportsApi[getData.ReportsCount] = result.m_ReportApi;
+
+                if( getData.Queries != nullptr )
+                {
+                    getData.Queries[getData.ReportsCount] = result.m_Query;
+                }
+
+                if( getData.Slots != nullptr )
+                {
+                    getData.Slots[getData.ReportsCount] = result.m_Slot;
+                }
+
+                ++getData.ReportsCount;
+            }
+
+            return log.m_Result;
+        }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Checks if the query of a resolved report is still registered.
+        ///         Registered queries are only looked up if some query has been
+        ///         deleted after the report was resolved, since a new query can
+        ///         be created in memory of a deleted one.
+        /// @param  result  resolved report.
+        /// @return         true if the report belongs to a live query.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE bool IsRegistered( const Result& result )
+        {
+            if( result.m_UnregisteredCount == m_Unregistered.load( std::memory_order_acquire ) )
+            {
+                return true;
+            }
+
+            std::lock_guard<std::mutex> guard( m_Mutex );
+
+            const auto query = m_Queries.find( static_cast<TT::Queries::HwCounters*>( result.m_Query.data ) );
+
+            return query != m_Queries.end() && ( *query )->m_Generation == result.m_Generation;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Background thread loop. Sleeps until a query slot ends,
+        ///        then polls while ended slots are not resolved yet.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void Run()
+        {
+            std::unique_lock<std::mutex> lock( m_WakeMutex );
+
+            while( !m_Exit )
+            {
+                m_Wake = false;
+                lock.unlock();
+
+                bool pending = false;
+
+                {
+                    std::lock_guard<std::mutex> guard( m_Mutex );
+                    pending = Resolve();
+                }
+
+                lock.lock();
+
+                const auto isWoken = [this]() { return m_Wake || m_Exit; };
+
+                if( pending )
+                {
+                    m_Condition.wait_for( lock, std::chrono::milliseconds( Constants::Query::m_AsyncResolveInterval ), isWoken );
+                }
+                else
+                {
+                    m_Condition.wait( lock, isWoken );
+                }
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Resolves ready slots of all registered queries while
+        ///         the ring of api reports has space. Must be called with
+        ///         the resolver mutex locked, so there is a single producer.
+        ///         Each query is locked only while its slots are resolved.
+        /// @return true if some ended slots are still not resolved.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE bool Resolve()
+        {
+            bool pending = false;
+
+            for( auto query : m_Queries )
+            {
+                const auto guard     = query->Lock();
+                auto&      slots     = query->m_Slots;
+                uint32_t   slotIndex = 0;
+
+                // Skip queries without ready slots.
+                while( slotIndex < slots.size() && !IsSlotReady( slots[slotIndex] ) )
+                {
+                    pending |= IsSlotEnded( slots[slotIndex] );
+                    ++slotIndex;
+                }
+
+                if( slotIndex == slots.size() || ML_FAIL( query->ValidateConfigurationActivation() ) )
+                {
+                    continue;
+                }
+
+                const auto batchState = T::Queries::HwCountersCalculator::GetBatchState( *query );
+
+                for( ; slotIndex < slots.size(); ++slotIndex )
+                {
+                    if( IsSlotReady( slots[slotIndex] ) )
+                    {
+                        ResolveSlot( *query, batchState, slotIndex );
+                    }
+
+                    pending |= IsSlotEnded( slots[slotIndex] );
+                }
+            }
+
+            return pending;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Resolves a ready query slot into api reports. A multisampled
+        ///        slot produces one api report per subsample, if the ring
+        ///        becomes full the slot stays ended and the next pass
+        ///        continues from the first subsample not resolved yet.
+        /// @param query        hw counters query.
+        /// @param batchState   slot independent calculation state.
+        /// @param slotIndex    query slot index.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void ResolveSlot(
+            TT::Queries::HwCounters&                             query,
+            const TT::Queries::HwCountersCalculator::BatchState& batchState,
+            const uint32_t                                       slotIndex )
+        {
+            auto&  slot   = query.m_Slots[slotIndex];
+            Result result = {};
+
+            result.m_Query             = query.GetHandle();
+            result.m_Generation        = query.m_Generation;
+            result.m_UnregisteredCount = m_Unregistered.load( std::memory_order_relaxed );
+            result.m_Slot              = slotIndex;
+
+            // Enqueue cannot fail once the report is calculated, since
+            // calculation consumes oa buffer state of the slot.
+            while( m_Results.CanEnqueue() )
+            {
+                TT::Queries::HwCountersCalculator calculator = { batchState, slotIndex, query, result.m_ReportApi };
+
+                // Gpu report may still wait for oa buffer reports.
+                if( calculator.GetReportApi() == StatusCode::ReportNotReady )
+                {
+                    return;
+                }
+
+                // Reports that failed to resolve are returned with their flags.
+                slot.UpdateState( T::Queries::HwCountersSlot::State::Resolved );
+                m_Results.Enqueue( result );
+
+                if( query.m_GetDataMode != T::Layouts::HwCounters::Query::GetDataMode::Multisampled ||
+                    result.m_ReportApi.m_ReportId >= result.m_ReportApi.m_ReportsCount )
+                {
+                    return;
+                }
+
+                // More subsamples to resolve.
+                slot.UpdateState( T::Queries::HwCountersSlot::State::Ended );
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Checks if query slot has ended and gpu completed it.
+        /// @param  slot    query slot.
+        /// @return         true if slot can be resolved.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static bool IsSlotReady( const TT::Queries::HwCountersSlot& slot )
+        {
+            return IsSlotEnded( slot ) && slot.IsEndTagReady();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Checks if query slot has ended and is not resolved yet.
+        /// @param  slot    query slot.
+        /// @return         true if slot has ended.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static bool IsSlotEnded( const TT::Queries::HwCountersSlot& slot )
+        {
+            return slot.m_State == T::Queries::HwCountersSlot::State::Ended;
+        }
+    };
+} // namespace ML
@@ -45,6 +45,8 @@ namespace ML::BASE
         /// @brief Members.
         //////////////////////////////////////////////////////////////////////////
         GpuMemory_1_0                                        m_GpuMemory;                 // Gpu memory associated with query slot.
+        uint64_t                                             m_EndTagGpuAddress;          // Gpu address of the end tag written by gpu.
+        uint64_t*                                            m_EndTagCpuAddress;          // Cpu address of the end tag written by gpu.
         uint64_t                                             m_EndTag;                    // End tag / completion status.
         uint32_t                                             m_ApiReportIndex;            // Current report id exposed by api.
         uint32_t                                             m_ApiReportsCount;           // Reports count exposed by api.
@@ -63,6 +65,8 @@ namespace ML::BASE
         QueryHwCountersSlotTrait( TT::Context& context )
             : Base()
             , m_GpuMemory{}
+            , m_EndTagGpuAddress( 0 )
+            , m_EndTagCpuAddress( nullptr )
             , m_EndTag( 0 )
             , m_ApiReportIndex( 1 )
             , m_ApiReportsCount( 1 )
@@ -83,6 +87,8 @@ namespace ML::BASE
         QueryHwCountersSlotTrait( const QueryHwCountersSlotTrait& slot )
             : Base()
             , m_GpuMemory{}
+            , m_EndTagGpuAddress( 0 )
+            , m_EndTagCpuAddress( nullptr )
             , m_EndTag( slot.m_EndTag )
             , m_ApiReportIndex( slot.m_ApiReportIndex )
             , m_ApiReportsCount( slot.m_ApiReportsCount )
@@ -103,6 +109,8 @@ namespace ML::BASE
         QueryHwCountersSlotTrait( QueryHwCountersSlotTrait&& slot )
             : Base()
             , m_GpuMemory( slot.m_GpuMemory )
+            , m_EndTagGpuAddress( slot.m_EndTagGpuAddress )
+            , m_EndTagCpuAddress( slot.m_EndTagCpuAddress )
             , m_EndTag( slot.m_EndTag )
             , m_ApiReportIndex( slot.m_ApiReportIndex )
             , m_ApiReportsCount( slot.m_ApiReportsCount )
@@ -159,6 +167,35 @@ namespace ML::BASE
             return *static_cast<TT::Layouts::HwCounters::Query::ReportGpu*>( m_GpuMemory.CpuAddress );
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns end tag written by gpu for a given slot. Gpu report
+        ///         reads that follow cannot be reordered before the end tag read,
+        ///         so a report copied after a matching tag is complete.
+        /// @return end tag.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE uint64_t GetEndTag() const
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+            ML_ASSERT( m_EndTagCpuAddress );
+
+            const uint64_t endTag = *static_cast<const volatile uint64_t*>( m_EndTagCpuAddress );
+            std::atomic_thread_fence( std::memory_order_acquire );
+
+            return endTag;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Checks if query end has been submitted and gpu already
+        ///         wrote the expected end tag.
+        /// @return true if gpu report is ready.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE bool IsEndTagReady() const
+        {
+            const bool ended = m_State == State::Ended || m_State == State::Resolved;
+
+            return ended && m_EndTagCpuAddress && *m_EndTagCpuAddress == m_EndTag;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief Clears gpu memory for a given slot.
         //////////////////////////////////////////////////////////////////////////
@@ -166,6 +203,11 @@ namespace ML::BASE
         {
             auto reportGpu = static_cast<TT::Layouts::HwCounters::Query::ReportGpu*>( m_GpuMemory.CpuAddress );
 
+            if( m_EndTagCpuAddress != nullptr )
+            {
+                *m_EndTagCpuAddress = 0;
+            }
+
             if( reportGpu != nullptr )
             {
                 *reportGpu = {};
@@ -0,0 +1,292 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2026 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+/*
+@file ml_thread_pool.h
+
+@brief Worker threads owned by the context. Workers are started once and
+       execute parallel task ranges together with the calling thread,
+       so requests do not create threads on each call.
+*/
+
+#pragma once
+
+namespace ML
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Base type for ThreadPoolTrait object.
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct ThreadPoolTrait
+    {
+        ML_DELETE_DEFAULT_CONSTRUCTOR( ThreadPoolTrait );
+        ML_DELETE_DEFAULT_COPY_AND_MOVE( ThreadPoolTrait );
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Types.
+        //////////////////////////////////////////////////////////////////////////
+        using Task = std::function<void( const uint32_t )>;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Members.
+        //////////////////////////////////////////////////////////////////////////
+        TT::Context&             m_Context;
+        bool                     m_Exit;         // Requests worker threads to exit.
+        uint64_t                 m_Job;          // Incremented for each task executed in parallel.
+        const Task*              m_Task;         // Task executed in parallel, null if none.
+        uint32_t                 m_TaskCount;    // Task ranges count.
+        uint32_t                 m_Active;       // Workers executing the task.
+        std::atomic<uint32_t>    m_NextIndex;    // Next task range to execute.
+        std::atomic<bool>        m_Failed;       // Set if a task range has thrown an exception.
+        std::mutex               m_Mutex;        // Guards task and exit requests.
+        std::mutex               m_ExecuteMutex; // Allows a single task executed in parallel.
+        std::condition_variable  m_Condition;    // Wakes workers up.
+        std::condition_variable  m_Done;         // Wakes calling thread up once workers are idle.
+        std::vector<std::thread> m_Threads;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief ThreadPoolTrait constructor.
+        /// @param context  context.
+        //////////////////////////////////////////////////////////////////////////
+        ThreadPoolTrait( TT::Context& context )
+            : m_Context( context )
+            , m_Exit( false )
+            , m_Job( 0 )
+            , m_Task( nullptr )
+            , m_TaskCount( 0 )
+            , m_Active( 0 )
+            , m_NextIndex( 0 )
+            , m_Failed( false )
+            , m_Threads{}
+        {
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief ThreadPoolTrait destructor.
+        //////////////////////////////////////////////////////////////////////////
+        ~ThreadPoolTrait()
+        {
+            Release();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Starts worker threads requested by client options.
+        ///         Workers are used in release builds only, since function
+        ///         logs are not thread safe.
+        /// @return operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode Initialize()
+        {
+            ML_FUNCTION_LOG( StatusCode::Success, &m_Context );
+
+#if ML_RELEASE
+            const uint32_t requestedCount = m_Context.m_ClientOptions.m_ResolveThreadsCount;
+            const uint32_t hardwareCount  = std::max( std::thread::hardware_concurrency(), 1u );
+            const uint32_t threadsCount   = std::min( requestedCount, hardwareCount );
+
+            if( threadsCount <= 1 )
+            {
+                return log.m_Result;
+            }
+
+            try
+            {
+                // The calling thread executes task ranges as well.
+                m_Threads.reserve( threadsCount - 1 );
+
+                while( m_Threads.size() < threadsCount - 1 )
+                {
+                    m_Threads.emplace_back( [this]() { Run(); } );
+                }
+            }
+            catch( ... )
+            {
+                // Tasks are executed by already started workers.
+                log.Warning( "Unable to start worker threads, started", m_Threads.size() );
+            }
+#endif // ML_RELEASE
+
+            return log.m_Result;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Stops worker threads.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void Release()
+        {
+            if( m_Threads.empty() )
+            {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> guard( m_Mutex );
+                m_Exit = true;
+            }
+
+            m_Condition.notify_all();
+
+            for( auto& thread : m_Threads )
+            {
+                thread.join();
+            }
+
+            m_Threads.clear();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns threads count executing a task, including
+        ///         the calling thread.
+        /// @return threads count.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE uint32_t GetThreadsCount() const
+        {
+            return static_cast<uint32_t>( m_Threads.size() ) + 1;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Executes all task ranges on workers and the calling thread.
+        ///         A task requested while another one is executed in parallel
+        ///         runs on its calling thread only. Exceptions thrown by task
+        ///         ranges do not leave the pool.
+        /// @param  count   task ranges count.
+        /// @param  task    task called with a range index.
+        /// @return         operation status.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE StatusCode Execute(
+            const uint32_t count,
+            const Task&    task )
+        {
+            std::unique_lock<std::mutex> execute( m_ExecuteMutex, std::try_to_lock );
+
+            if( !execute.owns_lock() || m_Threads.empty() )
+            {
+                bool failed = false;
+
+                for( uint32_t i = 0; i < count; ++i )
+                {
+                    failed |= !ExecuteRange( task, i );
+                }
+
+                return failed
+                    ? StatusCode::Failed
+                    : StatusCode::Success;
+            }
+
+            {
+                std::lock_guard<std::mutex> guard( m_Mutex );
+
+                m_Task      = &task;
+                m_TaskCount = count;
+                m_NextIndex.store( 0, std::memory_order_relaxed );
+                m_Failed.store( false, std::memory_order_relaxed );
+                ++m_Job;
+            }
+
+            m_Condition.notify_all();
+
+            ExecuteRanges( task, count );
+
+            {
+                // Task cannot be referenced by workers once they are idle.
+                std::unique_lock<std::mutex> lock( m_Mutex );
+                m_Done.wait( lock, [this]() { return m_Active == 0; } );
+
+                m_Task      = nullptr;
+                m_TaskCount = 0;
+            }
+
+            return m_Failed.load( std::memory_order_relaxed )
+                ? StatusCode::Failed
+                : StatusCode::Success;
+        }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Worker thread loop. Sleeps until a task is executed
+        ///        in parallel or the pool is released.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void Run()
+        {
+            std::unique_lock<std::mutex> lock( m_Mutex );
+            uint64_t                     job = m_Job;
+
+            while( true )
+            {
+                m_Condition.wait( lock, [&]() { return m_Exit || m_Job != job; } );
+
+                if( m_Exit )
+                {
+                    return;
+                }
+
+                job = m_Job;
+
+                // Task has already been executed by other threads.
+                if( m_Task == nullptr )
+                {
+                    continue;
+                }
+
+                const Task&    task  = *m_Task;
+                const uint32_t count = m_TaskCount;
+
+                ++m_Active;
+                lock.unlock();
+
+                ExecuteRanges( task, count );
+
+                lock.lock();
+
+                if( --m_Active == 0 )
+                {
+                    m_Done.notify_one();
+                }
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Executes task ranges not taken by other threads yet.
+        /// @param task     task called with a range index.
+        /// @param count    task ranges count.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void ExecuteRanges(
+            const Task&    task,
+            const uint32_t count )
+        {
+            for( uint32_t i = m_NextIndex.fetch_add( 1, std::memory_order_relaxed ); i < count; i = m_NextIndex.fetch_add( 1, std::memory_order_relaxed ) )
+            {
+                if( !ExecuteRange( task, i ) )
+                {
+                    m_Failed.store( true, std::memory_order_relaxed );
+                }
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Executes a single task range.
+        /// @param  task    task called with a range index.
+        /// @param  index   task range index.
+        /// @return         false if the task range has thrown an exception.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static bool ExecuteRange(
+            const Task&    task,
+            const uint32_t index )
+        {
+            try
+            {
+                task( index );
+                return true;
+            }
+            catch( ... )
+            {
+                return false;
+            }
+        }
+    };
+} // namespace ML
@@ -347,25 +347,65 @@ namespace ML
             }
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns a difference between two measure points for counters
+        ///         with bitsize known at compile time. Counters overflow is handled
+        ///         by modular subtraction, so there is no branch and loops using
+        ///         this function can be vectorized by the compiler.
+        /// @param  end     end counter.
+        /// @param  begin   begin counter.
+        /// @return         difference between two measure points.
+        //////////////////////////////////////////////////////////////////////////
+        template <uint32_t bitsize>
+        ML_INLINE static uint64_t CountersDelta(
+            const uint64_t end,
+            const uint64_t begin )
+        {
+            static_assert( bitsize > 0 && bitsize <= 64, "Invalid counter bitsize" );
+
+            if constexpr( bitsize == 64 )
+            {
+                return end - begin;
+            }
+            else
+            {
+                constexpr uint64_t mask = ML_BITMASK( bitsize );
+
+                return ( end - begin ) & mask;
+            }
+        }
+
         //////////////////////////////////////////////////////////////////////////
         /// @brief  Checks whether Metrics Library debug layer is enabled.
         /// @return true if the debug log layer is enabled, false otherwise.
         //////////////////////////////////////////////////////////////////////////
         ML_INLINE static bool CheckLogLayer()
         {
-            return IuLogCheckLayer( IU_DBG_LAYER_ML );
+            return g_IuLogsControl.LogLayerEnable & IU_DBG_LAYER_ML;
         }
 
         //////////////////////////////////////////////////////////////////////////
-        /// @brief  Checks debug log level.
+        /// @brief  Checks debug log level. Reads log settings directly instead
+        ///         of calling IuLogCheckLevel, so a disabled level costs a single
+        ///         inlined branch.
         /// @param  level   debug log level.
         /// @return         true if the debug log level is enabled, false otherwise.
         //////////////////////////////////////////////////////////////////////////
         ML_INLINE static bool CheckLogLevel( const LogType level )
         {
-            const uint32_t debugLevel = static_cast<uint32_t>( level );
+            const uint32_t debugLevel   = static_cast<uint32_t>( level );
+            const bool     levelEnabled = ( debugLevel & IU_DBG_CONSOLE_DUMP ) || ( g_IuLogsControl.LogLevel & debugLevel & IU_DBG_SEV_MASK );
+
+            return levelEnabled && CheckLogLayer();
+        }
 
-            return IuLogCheckLevel( debugLevel, IU_DBG_LAYER_ML );
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Checks whether logs are stored as a binary trace.
+        /// @return true if the binary trace is enabled.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static bool CheckBinaryTrace()
+        {
+            return g_IuLogsControl.LogLevel & IU_DBG_BINARY_TRACE;
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -402,13 +442,20 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         template <typename... Values>
         ML_INLINE static void Log(
-            const LogType      type,
-            const std::string& functionName,
-            TT::Context*       context,
+            const LogType type,
+            const char*   functionName,
+            TT::Context*  context,
             const Values&... values )
         {
             if( CheckLogLevel( type ) )
             {
+                if( CheckBinaryTrace() )
+                {
+                    // Values are stored as raw bytes and formatted offline.
+                    T::Trace::Write( type, functionName, context ? context->m_AdapterId : IU_ADAPTER_ID_UNKNOWN, values... );
+                    return;
+                }
+
                 if( context == nullptr )
                 {
                     LogWithoutContext( type, functionName, values... );
@@ -442,8 +489,8 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         template <typename... Values>
         ML_INLINE static void LogWithoutContext(
-            const LogType      type,
-            const std::string& functionName,
+            const LogType type,
+            const char*   functionName,
             const Values&... values )
         {
             TT::Debug debug = {};
@@ -581,50 +628,50 @@ namespace ML
         //////////////////////////////////////////////////////////////////////////
         ML_INLINE static void Print(
             const LogType      type,
-            const std::string& functionName,
+            const char*        functionName,
             const std::string& message,
             const uint32_t     adapterId )
         {
             switch( type )
             {
                 case LogType::Critical:
-                    ML_LOG( adapterId, LOG_CRITICAL, functionName.c_str(), message.c_str() );
+                    ML_LOG( adapterId, LOG_CRITICAL, functionName, message.c_str() );
                     break;
 
                 case LogType::Error:
-                    ML_LOG( adapterId, LOG_ERROR, functionName.c_str(), message.c_str() );
+                    ML_LOG( adapterId, LOG_ERROR, functionName, message.c_str() );
                     break;
 
                 case LogType::Warning:
-                    ML_LOG( adapterId, LOG_WARNING, functionName.c_str(), message.c_str() );
+                    ML_LOG( adapterId, LOG_WARNING, functionName, message.c_str() );
                     break;
 
                 case LogType::Debug:
-                    ML_LOG( adapterId, LOG_DEBUG, functionName.c_str(), message.c_str() );
+                    ML_LOG( adapterId, LOG_DEBUG, functionName, message.c_str() );
                     break;
 
                 case LogType::Info:
-                    ML_LOG( adapterId, LOG_INFO, functionName.c_str(), message.c_str() );
+                    ML_LOG( adapterId, LOG_INFO, functionName, message.c_str() );
                     break;
 
                 case LogType::Traits:
-                    ML_LOG( adapterId, LOG_TRAITS, functionName.c_str(), message.c_str() );
+                    ML_LOG( adapterId, LOG_TRAITS, functionName, message.c_str() );
                     break;
 
                 case LogType::Entered:
-                    ML_LOG( adapterId, LOG_ENTERED, functionName.c_str(), message.c_str() );
+                    ML_LOG( adapterId, LOG_ENTERED, functionName, message.c_str() );
                     break;
 
                 case LogType::Exiting:
-                    ML_LOG( adapterId, LOG_EXITING, functionName.c_str(), message.c_str() );
+                    ML_LOG( adapterId, LOG_EXITING, functionName, message.c_str() );
                     break;
 
                 case LogType::Input:
-                    ML_LOG( adapterId, LOG_INPUT, functionName.c_str(), message.c_str() );
+                    ML_LOG( adapterId, LOG_INPUT, functionName, message.c_str() );
                     break;
 
                 case LogType::Output:
-                    ML_LOG( adapterId, LOG_OUTPUT, functionName.c_str(), message.c_str() );
+                    ML_LOG( adapterId, LOG_OUTPUT, functionName, message.c_str() );
                     break;
 
                 default:
@@ -0,0 +1,839 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2026 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+/*
+@file ml_trace.h
+
+@brief Binary trace of library logs. Each log is stored as fixed-size records
+       in a per-thread lock-free ring and a background thread flushes rings
+       to a file, which is printed out offline by ml_trace_decoder tool.
+*/
+
+#pragma once
+
+namespace ML
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Binary trace layouts shared with the trace decoder.
+    //////////////////////////////////////////////////////////////////////////
+    struct TraceBase
+    {
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Trace entry kinds. Each entry starts with kind and
+        ///        a count of records it occupies.
+        //////////////////////////////////////////////////////////////////////////
+        enum class EntryKind : uint32_t
+        {
+            File,    // Trace file header.
+            Name,    // Function name for a function id.
+            Message, // Log message followed by its values.
+            Dropped, // Messages dropped because a thread ring was full.
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Fixed-size record.
+        //////////////////////////////////////////////////////////////////////////
+        struct Record
+        {
+            uint8_t m_Data[Constants::Trace::m_RecordSize];
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Trace file header entry.
+        //////////////////////////////////////////////////////////////////////////
+        struct FileEntry
+        {
+            EntryKind m_Kind;
+            uint32_t  m_RecordsCount;
+            char      m_Magic[8];
+            uint32_t  m_Version;
+            uint32_t  m_RecordSize;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Function name entry, followed by name characters.
+        //////////////////////////////////////////////////////////////////////////
+        struct NameEntry
+        {
+            EntryKind m_Kind;
+            uint32_t  m_RecordsCount;
+            uint64_t  m_FunctionId;
+            uint32_t  m_Length;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Log message entry, followed by values.
+        //////////////////////////////////////////////////////////////////////////
+        struct MessageEntry
+        {
+            EntryKind m_Kind;
+            uint32_t  m_RecordsCount;
+            uint64_t  m_Timestamp; // Nanoseconds.
+            uint64_t  m_FunctionId;
+            uint32_t  m_AdapterId;
+            uint32_t  m_ThreadId;  // Index of the thread in the trace.
+            LogType   m_LogType;
+            uint32_t  m_ValuesCount;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Value header, followed by value bytes padded to 8 bytes.
+        //////////////////////////////////////////////////////////////////////////
+        struct ValueEntry
+        {
+            uint32_t m_TypeId;
+            uint32_t m_Size; // Original value size, opaque values have no bytes.
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Dropped messages entry.
+        //////////////////////////////////////////////////////////////////////////
+        struct DroppedEntry
+        {
+            EntryKind m_Kind;
+            uint32_t  m_RecordsCount;
+            uint64_t  m_DroppedCount;
+            uint32_t  m_ThreadId;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Types stored as raw bytes and printed out by the decoder
+        ///        with debug helper. Only types without pointers that debug
+        ///        helper dereferences can be listed, new types are appended.
+        //////////////////////////////////////////////////////////////////////////
+        using Types = std::tuple<
+            bool,
+            float,
+            double,
+            uint8_t,
+            uint16_t,
+            uint32_t,
+            uint64_t,
+            int8_t,
+            int16_t,
+            int32_t,
+            int64_t,
+            ClientApi,
+            ClientGen,
+            ClientOptionsType,
+            GpuCommandBufferType,
+            GpuConfigurationActivationType,
+            MemoryFlags,
+            MemoryType,
+            ObjectType,
+            ParameterType,
+            StatusCode,
+            ValueType,
+            ClientOptionsData_1_0,
+            ClientType_1_0,
+            CommandBufferData_1_0,
+            CommandBufferSize_1_0,
+            ConfigurationActivateData_1_0,
+            ConfigurationCreateData_1_0,
+            ConfigurationHandle_1_0,
+            ContextHandle_1_0,
+            GpuMemory_1_0,
+            MarkerCreateData_1_0,
+            MarkerHandle_1_0,
+            OverrideCreateData_1_0,
+            OverrideHandle_1_0,
+            QueryCreateData_1_0,
+            QueryHandle_1_0>;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Type ids not present in types list.
+        //////////////////////////////////////////////////////////////////////////
+        static constexpr uint32_t m_TypeOpaque  = 0; // Unknown type, only its size is stored.
+        static constexpr uint32_t m_TypeString  = 1; // Characters, possibly truncated.
+        static constexpr uint32_t m_TypePointer = 2; // Pointer address.
+        static constexpr uint32_t m_TypeFirst   = 3; // Types list offset.
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns a type id of a given value type.
+        /// @return type id.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename Value, size_t index = 0>
+        ML_INLINE static constexpr uint32_t GetTypeId()
+        {
+            if constexpr( index == std::tuple_size_v<Types> )
+            {
+                return m_TypeOpaque;
+            }
+            else if constexpr( std::is_same_v<Value, std::tuple_element_t<index, Types>> )
+            {
+                return m_TypeFirst + static_cast<uint32_t>( index );
+            }
+            else
+            {
+                return GetTypeId<Value, index + 1>();
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Converts traced value to a string.
+        /// @param  debug   debug helper.
+        /// @param  typeId  value type id.
+        /// @param  data    value bytes.
+        /// @param  size    value size.
+        /// @return         converted value.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename Debug, size_t index = 0>
+        ML_INLINE static std::string ValueToString(
+            Debug&         debug,
+            const uint32_t typeId,
+            const uint8_t* data,
+            const uint32_t size )
+        {
+            if constexpr( index == std::tuple_size_v<Types> )
+            {
+                switch( typeId )
+                {
+                    case m_TypeString:
+                        return std::string( reinterpret_cast<const char*>( data ), size );
+
+                    case m_TypePointer:
+                    {
+                        uint64_t address = 0;
+                        iu_memcpy_s( &address, sizeof( address ), data, sizeof( address ) );
+                        return debug.ToString( reinterpret_cast<const void*>( static_cast<uintptr_t>( address ) ) );
+                    }
+
+                    default:
+                        return "<" + std::to_string( size ) + " bytes>";
+                }
+            }
+            else
+            {
+                using Type = std::tuple_element_t<index, Types>;
+
+                if( typeId == m_TypeFirst + index && size == sizeof( Type ) )
+                {
+                    Type value = {};
+                    iu_memcpy_s( &value, sizeof( value ), data, sizeof( value ) );
+                    return debug.ToString( value );
+                }
+
+                return ValueToString<Debug, index + 1>( debug, typeId, data, size );
+            }
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief Trace object. A single instance is shared by all contexts
+    ///        and traits, so the process writes one trace file.
+    //////////////////////////////////////////////////////////////////////////
+    struct Trace : TraceBase
+    {
+        ML_DELETE_DEFAULT_COPY_AND_MOVE( Trace );
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Single producer / single consumer ring of records. Written
+        ///        only by its owning thread and read only by the flush thread.
+        //////////////////////////////////////////////////////////////////////////
+        struct Ring
+        {
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Members.
+            //////////////////////////////////////////////////////////////////////////
+            std::unique_ptr<Record[]>           m_Records;
+            const uint32_t                      m_ThreadId;
+            std::atomic<uint64_t>               m_Dropped;         // Updated by the owning thread.
+            uint64_t                            m_DroppedReported; // Used by the flush thread.
+            alignas( 64 ) std::atomic<uint64_t> m_WritePosition;   // Separate cache lines avoid false sharing
+            alignas( 64 ) std::atomic<uint64_t> m_ReadPosition;    // between the owning and flush threads.
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Ring constructor.
+            /// @param threadId owning thread id.
+            //////////////////////////////////////////////////////////////////////////
+            Ring( const uint32_t threadId )
+                : m_Records( new( std::nothrow ) Record[Constants::Trace::m_RingRecordsCount] )
+                , m_ThreadId( threadId )
+                , m_Dropped( 0 )
+                , m_DroppedReported( 0 )
+                , m_WritePosition( 0 )
+                , m_ReadPosition( 0 )
+            {
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief  Adds records of a single entry to the ring.
+            /// @param  records records to add.
+            /// @param  count   records count.
+            /// @return         false if ring is full.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE bool Push(
+                const Record*  records,
+                const uint32_t count )
+            {
+                constexpr uint64_t capacity      = Constants::Trace::m_RingRecordsCount;
+                const uint64_t     writePosition = m_WritePosition.load( std::memory_order_relaxed );
+                const uint64_t     readPosition  = m_ReadPosition.load( std::memory_order_acquire );
+
+                if( capacity - ( writePosition - readPosition ) < count )
+                {
+                    m_Dropped.fetch_add( 1, std::memory_order_relaxed );
+                    return false;
+                }
+
+                for( uint32_t i = 0; i < count; ++i )
+                {
+                    m_Records[( writePosition + i ) & ( capacity - 1 )] = records[i];
+                }
+
+                m_WritePosition.store( writePosition + count, std::memory_order_release );
+
+                return true;
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Writes all ring records to a file.
+            /// @param file output file.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE void Pop( std::ofstream& file )
+            {
+                constexpr uint64_t capacity      = Constants::Trace::m_RingRecordsCount;
+                const uint64_t     writePosition = m_WritePosition.load( std::memory_order_acquire );
+                uint64_t           readPosition  = m_ReadPosition.load( std::memory_order_relaxed );
+
+                while( readPosition != writePosition )
+                {
+                    const uint64_t index = readPosition & ( capacity - 1 );
+                    const uint64_t count = std::min( writePosition - readPosition, capacity - index );
+
+                    file.write( reinterpret_cast<const char*>( &m_Records[index] ), count * sizeof( Record ) );
+                    readPosition += count;
+                }
+
+                m_ReadPosition.store( readPosition, std::memory_order_release );
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief  Checks if ring is at least half full.
+            /// @return true if ring should be flushed soon.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE bool IsHalfFull() const
+            {
+                const uint64_t writePosition = m_WritePosition.load( std::memory_order_relaxed );
+                const uint64_t readPosition  = m_ReadPosition.load( std::memory_order_relaxed );
+
+                return ( writePosition - readPosition ) >= Constants::Trace::m_RingRecordsCount / 2;
+            }
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Builds records of a single entry.
+        //////////////////////////////////////////////////////////////////////////
+        struct Entry
+        {
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Members.
+            //////////////////////////////////////////////////////////////////////////
+            std::array<Record, Constants::Trace::m_MessageRecordsCount> m_Records;
+            uint32_t                                                    m_Size;
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Entry constructor.
+            //////////////////////////////////////////////////////////////////////////
+            Entry()
+                : m_Size( 0 )
+            {
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief  Returns records count used by the entry.
+            /// @return records count.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE uint32_t GetRecordsCount() const
+            {
+                return ( m_Size + sizeof( Record ) - 1 ) / sizeof( Record );
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief  Returns free space in the entry.
+            /// @return free bytes.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE uint32_t GetFreeSize() const
+            {
+                return sizeof( m_Records ) - m_Size;
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Appends bytes to the entry, padded to 8 bytes.
+            /// @param data bytes to append.
+            /// @param size bytes count.
+            //////////////////////////////////////////////////////////////////////////
+            ML_INLINE void Append(
+                const void*    data,
+                const uint32_t size )
+            {
+                ML_ASSERT_NO_ADAPTER( size <= GetFreeSize() );
+
+                iu_memcpy_s( reinterpret_cast<uint8_t*>( m_Records.data() ) + m_Size, GetFreeSize(), data, size );
+                m_Size = std::min<uint32_t>( ( m_Size + size + 7 ) & ~7u, sizeof( m_Records ) );
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            /// @brief Writes entry header at the beginning of the entry.
+            /// @param header   entry header.
+            //////////////////////////////////////////////////////////////////////////
+            template <typename Header>
+            ML_INLINE void SetHeader( Header header )
+            {
+                header.m_RecordsCount = GetRecordsCount();
+                iu_memcpy_s( m_Records.data(), sizeof( m_Records ), &header, sizeof( header ) );
+            }
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Members.
+        //////////////////////////////////////////////////////////////////////////
+        std::vector<std::shared_ptr<Ring>> m_Rings;        // Rings of all tracing threads.
+        std::ofstream                      m_File;
+        uint32_t                           m_ThreadsCount; // Assigns trace thread ids.
+        bool                               m_Exit;         // Requests flush thread to exit.
+        std::mutex                         m_Mutex;        // Guards rings list and file.
+        std::condition_variable            m_Condition;
+        std::thread                        m_Thread;
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Trace constructor.
+        //////////////////////////////////////////////////////////////////////////
+        Trace()
+            : m_Rings{}
+            , m_File{}
+            , m_ThreadsCount( 0 )
+            , m_Exit( false )
+        {
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Trace destructor. Flushes remaining records.
+        //////////////////////////////////////////////////////////////////////////
+        ~Trace()
+        {
+            if( m_Thread.joinable() )
+            {
+                {
+                    std::lock_guard<std::mutex> guard( m_Mutex );
+                    m_Exit = true;
+                }
+
+                m_Condition.notify_one();
+                m_Thread.join();
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns trace instance shared by all threads.
+        /// @return trace instance.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static Trace& GetInstance()
+        {
+            static Trace trace;
+            return trace;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Stores a log message in the calling thread ring.
+        /// @param type         log type.
+        /// @param functionName function name, its address is used as function id.
+        /// @param adapterId    adapter id.
+        /// @param values       user's message.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename... Values>
+        ML_INLINE static void Write(
+            const LogType  type,
+            const char*    functionName,
+            const uint32_t adapterId,
+            const Values&... values )
+        {
+            Ring* ring = GetRing();
+
+            if( ring == nullptr )
+            {
+                return;
+            }
+
+            WriteName( *ring, functionName );
+
+            Entry        entry   = {};
+            MessageEntry message = {};
+
+            message.m_Kind       = EntryKind::Message;
+            message.m_Timestamp  = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+            message.m_FunctionId = reinterpret_cast<uintptr_t>( functionName );
+            message.m_AdapterId  = adapterId;
+            message.m_ThreadId   = ring->m_ThreadId;
+            message.m_LogType    = type;
+
+            entry.Append( &message, sizeof( message ) );
+            ( WriteValue( entry, message.m_ValuesCount, values ), ... );
+            entry.SetHeader( message );
+
+            ring->Push( entry.m_Records.data(), entry.GetRecordsCount() );
+
+            if( ring->IsHalfFull() )
+            {
+                GetInstance().m_Condition.notify_one();
+            }
+        }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Returns the calling thread ring, registers it on first use.
+        /// @return ring, nullptr if it could not be allocated.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static Ring* GetRing()
+        {
+            thread_local std::shared_ptr<Ring> ring = GetInstance().Register();
+            return ring.get();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Allocates a ring for the calling thread. Opens trace file and
+        ///         starts flush thread with the first ring.
+        /// @return ring, nullptr if it could not be allocated.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE std::shared_ptr<Ring> Register()
+        {
+            std::lock_guard<std::mutex> guard( m_Mutex );
+
+            auto ring = std::shared_ptr<Ring>( new( std::nothrow ) Ring( m_ThreadsCount++ ) );
+
+            if( ring == nullptr || ring->m_Records == nullptr )
+            {
+                return nullptr;
+            }
+
+            if( !m_Thread.joinable() )
+            {
+                if( !Open() )
+                {
+                    return nullptr;
+                }
+
+                m_Thread = std::thread( [this]() { Run(); } );
+            }
+
+            m_Rings.push_back( ring );
+
+            return ring;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Opens trace file and writes its header.
+        /// @return true if the file has been opened.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE bool Open()
+        {
+            std::string fileName = Constants::Library::m_Name;
+
+            std::ostringstream timeOutput;
+            const time_t       timeCurrent = time( nullptr );
+            const tm           timeLocal   = *localtime( &timeCurrent );
+
+            timeOutput << std::put_time( &timeLocal, "%d-%m-%Y_%H-%M-%S" );
+
+            // Process id keeps traces of processes started within a second apart.
+            fileName += "_trace_";
+            fileName += timeOutput.str();
+            fileName += "_";
+            fileName += std::to_string( getpid() );
+            fileName += ".bin";
+
+            m_File.open( fileName, std::ios::binary );
+
+            if( !m_File.is_open() )
+            {
+                return false;
+            }
+
+            Entry     entry  = {};
+            FileEntry header = {};
+
+            header.m_Kind       = EntryKind::File;
+            header.m_Version    = Constants::Trace::m_Version;
+            header.m_RecordSize = Constants::Trace::m_RecordSize;
+            iu_strncpy_s( header.m_Magic, sizeof( header.m_Magic ), Constants::Trace::m_Magic, sizeof( header.m_Magic ) - 1 );
+
+            entry.Append( &header, sizeof( header ) );
+            entry.SetHeader( header );
+
+            m_File.write( reinterpret_cast<const char*>( entry.m_Records.data() ), entry.GetRecordsCount() * sizeof( Record ) );
+
+            return true;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Flushes rings periodically or when one of them is half full.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void Run()
+        {
+            std::unique_lock<std::mutex> lock( m_Mutex );
+            bool                         pending = false;
+
+            while( !m_Exit )
+            {
+                // Notifications sent during a flush are lost, so a busy ring
+                // is flushed again without waiting.
+                if( !pending )
+                {
+                    m_Condition.wait_for( lock, std::chrono::milliseconds( Constants::Trace::m_FlushInterval ) );
+                }
+
+                pending = Flush();
+            }
+
+            Flush();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief  Writes all rings to the trace file. Releases rings of exited
+        ///         threads once they are flushed. Called with the mutex locked.
+        /// @return true if any ring was at least half full.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE bool Flush()
+        {
+            bool pending = false;
+
+            for( auto ring = m_Rings.begin(); ring != m_Rings.end(); )
+            {
+                // Only the list holds rings of exited threads.
+                const bool exited = ring->use_count() == 1;
+
+                pending = pending || ( *ring )->IsHalfFull();
+
+                ( *ring )->Pop( m_File );
+                WriteDropped( **ring );
+
+                ring = exited ? m_Rings.erase( ring ) : ring + 1;
+            }
+
+            m_File.flush();
+
+            return pending;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Writes count of messages dropped since the last flush.
+        /// @param ring thread ring.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE void WriteDropped( Ring& ring )
+        {
+            const uint64_t dropped = ring.m_Dropped.load( std::memory_order_relaxed );
+
+            if( dropped != ring.m_DroppedReported )
+            {
+                Entry        entry  = {};
+                DroppedEntry header = {};
+
+                header.m_Kind         = EntryKind::Dropped;
+                header.m_DroppedCount = dropped - ring.m_DroppedReported;
+                header.m_ThreadId     = ring.m_ThreadId;
+
+                entry.Append( &header, sizeof( header ) );
+                entry.SetHeader( header );
+
+                m_File.write( reinterpret_cast<const char*>( entry.m_Records.data() ), entry.GetRecordsCount() * sizeof( Record ) );
+                ring.m_DroppedReported = dropped;
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Stores a function name the first time the calling thread
+        ///        uses its function id.
+        /// @param ring         calling thread ring.
+        /// @param functionName function name.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static void WriteName(
+            Ring&       ring,
+            const char* functionName )
+        {
+            thread_local std::unordered_set<const char*> names;
+
+            if( !names.insert( functionName ).second )
+            {
+                return;
+            }
+
+            Entry     entry = {};
+            NameEntry name  = {};
+
+            name.m_Kind       = EntryKind::Name;
+            name.m_FunctionId = reinterpret_cast<uintptr_t>( functionName );
+            name.m_Length     = static_cast<uint32_t>( iu_strnlen_s( functionName, entry.GetFreeSize() - sizeof( name ) ) );
+
+            entry.Append( &name, sizeof( name ) );
+            entry.Append( functionName, name.m_Length );
+            entry.SetHeader( name );
+
+            if( !ring.Push( entry.m_Records.data(), entry.GetRecordsCount() ) )
+            {
+                // Retry with the next message.
+                names.erase( functionName );
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Appends a value to the entry. Values not fitting into the entry
+        ///        are skipped, values of unknown types are stored as opaque.
+        /// @param entry        message entry.
+        /// @param valuesCount  message values count.
+        /// @param value        value to store.
+        //////////////////////////////////////////////////////////////////////////
+        template <typename Value>
+        ML_INLINE static void WriteValue(
+            Entry&       entry,
+            uint32_t&    valuesCount,
+            const Value& value )
+        {
+            using ValueT = std::remove_cv_t<Value>;
+
+            if constexpr( std::is_array_v<ValueT> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<ValueT>>, char> )
+            {
+                WriteString( entry, valuesCount, value, iu_strnlen_s( value, sizeof( ValueT ) ) );
+            }
+            else if constexpr( std::is_same_v<ValueT, const char*> || std::is_same_v<ValueT, char*> )
+            {
+                WriteString( entry, valuesCount, value, value ? iu_strnlen_s( value, Constants::Trace::m_MaxValueSize ) : 0 );
+            }
+            else if constexpr( std::is_same_v<ValueT, std::string> )
+            {
+                WriteString( entry, valuesCount, value.c_str(), value.size() );
+            }
+            else if constexpr( std::is_same_v<ValueT, GetReportData_1_0> )
+            {
+                WriteReportData( entry, valuesCount, value );
+            }
+            else if constexpr( std::is_pointer_v<ValueT> )
+            {
+                const uint64_t address = reinterpret_cast<uintptr_t>( value );
+                WriteData( entry, valuesCount, m_TypePointer, &address, sizeof( address ) );
+            }
+            else if constexpr( GetTypeId<ValueT>() != m_TypeOpaque && sizeof( ValueT ) <= Constants::Trace::m_MaxValueSize )
+            {
+                WriteData( entry, valuesCount, GetTypeId<ValueT>(), &value, sizeof( ValueT ) );
+            }
+            else
+            {
+                WriteData( entry, valuesCount, m_TypeOpaque, nullptr, sizeof( ValueT ) );
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Appends get data type and its active union member. Clients built
+        ///        against older headers pass a smaller union, so only the active
+        ///        member is stored and never the whole union.
+        /// @param entry        message entry.
+        /// @param valuesCount  message values count.
+        /// @param value        get data.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static void WriteReportData(
+            Entry&                   entry,
+            uint32_t&                valuesCount,
+            const GetReportData_1_0& value )
+        {
+            WriteValue( entry, valuesCount, value.Type );
+
+            switch( value.Type )
+            {
+                case ObjectType::QueryHwCounters:
+                case ObjectType::QueryHwCountersCopyReports:
+                case ObjectType::QueryPipelineTimestamps:
+                    WriteData( entry, valuesCount, m_TypeOpaque, nullptr, sizeof( value.Query ) );
+                    break;
+
+                case ObjectType::QueryHwCountersMultisampled:
+                    WriteData( entry, valuesCount, m_TypeOpaque, nullptr, sizeof( value.QueryMultisampled ) );
+                    break;
+
+                case ObjectType::QueryHwCountersCompact:
+                    WriteData( entry, valuesCount, m_TypeOpaque, nullptr, sizeof( value.QueryCompact ) );
+                    break;
+
+                case ObjectType::QueryHwCountersColumns:
+                    WriteData( entry, valuesCount, m_TypeOpaque, nullptr, sizeof( value.QueryColumns ) );
+                    break;
+
+                case ObjectType::QueryHwCountersReadiness:
+                    WriteData( entry, valuesCount, m_TypeOpaque, nullptr, sizeof( value.QueryReadiness ) );
+                    break;
+
+                case ObjectType::QueryHwCountersAsync:
+                    WriteData( entry, valuesCount, m_TypeOpaque, nullptr, sizeof( value.QueryAsync ) );
+                    break;
+
+                case ObjectType::OverrideUser:
+                case ObjectType::OverrideNullHardware:
+                case ObjectType::OverrideFlushCaches:
+                case ObjectType::OverridePoshQuery:
+                case ObjectType::OverrideDisablePoshPrimitives:
+                    WriteData( entry, valuesCount, m_TypeOpaque, nullptr, sizeof( value.Override ) );
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Appends a string to the entry, truncated to free space.
+        /// @param entry        message entry.
+        /// @param valuesCount  message values count.
+        /// @param value        characters.
+        /// @param length       characters count.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static void WriteString(
+            Entry&       entry,
+            uint32_t&    valuesCount,
+            const char*  value,
+            const size_t length )
+        {
+            if( entry.GetFreeSize() > sizeof( ValueEntry ) )
+            {
+                const uint32_t size = static_cast<uint32_t>( std::min<size_t>( { length, Constants::Trace::m_MaxValueSize, entry.GetFreeSize() - sizeof( ValueEntry ) } ) );
+                WriteData( entry, valuesCount, m_TypeString, value, size );
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// @brief Appends value header and value bytes to the entry.
+        /// @param entry        message entry.
+        /// @param valuesCount  message values count.
+        /// @param typeId       value type id.
+        /// @param data         value bytes, nullptr for opaque values.
+        /// @param size         value size.
+        //////////////////////////////////////////////////////////////////////////
+        ML_INLINE static void WriteData(
+            Entry&         entry,
+            uint32_t&      valuesCount,
+            const uint32_t typeId,
+            const void*    data,
+            const uint32_t size )
+        {
+            const uint32_t dataSize = ( data != nullptr ) ? size : 0;
+
+            if( entry.GetFreeSize() < sizeof( ValueEntry ) + dataSize )
+            {
+                return;
+            }
+
+            const ValueEntry header = { typeId, size };
+
+            entry.Append( &header, sizeof( header ) );
+
+            if( dataSize > 0 )
+            {
+                entry.Append( data, dataSize );
+            }
+
+            ++valuesCount;
+        }
+    };
+} // namespace ML
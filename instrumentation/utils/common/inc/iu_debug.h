@@ -166,6 +166,10 @@ extern "C"
 // if following flag is set, each debug log will be saved in the file
 #define IU_DBG_FILE_DUMP 0x10000000
 
+// if following flag is set, ML logs will be saved as binary records instead of text
+// (use ml_trace_decoder tool to print them out)
+#define IU_DBG_BINARY_TRACE 0x00400000
+
 // layers
 #define IU_DBG_LAYER_INSTR 0x00000001
 #define IU_DBG_LAYER_MD    0x00000002